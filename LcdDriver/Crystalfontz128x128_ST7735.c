@@ -38,15 +38,215 @@
 
 #include <ti/grlib/grlib.h>
 #include "Crystalfontz128x128_ST7735.h"
+// DriverLib is only needed by the MSP432 backend, the host builds the driver with HOST_LCD
+#ifndef HOST_BUILD
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#endif
 #include "HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h"
+#include "include/hal.h"
 #include <stdint.h>
+#include <string.h>
 
 uint8_t Lcd_Orientation;
 uint16_t Lcd_ScreenWidth, Lcd_ScreenHeigth;
 uint8_t Lcd_PenSolid, Lcd_FontSolid, Lcd_FlagRead;
 uint16_t Lcd_TouchTrim;
 
+#if LCD_FRAMEBUFFER
+//*****************************************************************************
+//
+// Off-screen framebuffer.  The drawing functions write 4-bit palette indexes
+// in RAM (8 KB instead of the 32 KB of the 16-bit panel memory) and record,
+// for every row, the span of pixels whose color changed.  Flush sends only
+// those spans.  Drawing a pixel with the color it already has costs nothing,
+// so clearing the screen and redrawing a similar text only sends the pixels
+// that differ.
+//
+// The palette holds the first 16 colors drawn.  Once it is full, other
+// colors are drawn with the closest color of the palette.
+//
+//*****************************************************************************
+static uint8_t Lcd_Framebuffer[LCD_VERTICAL_MAX][LCD_HORIZONTAL_MAX / 2];
+static uint16_t Lcd_Palette[LCD_PALETTE_SIZE];
+static uint8_t Lcd_PaletteUsed;
+
+// changed pixels of every row, from Lcd_DirtyMin to Lcd_DirtyMax included,
+// the row is clean when Lcd_DirtyMin > Lcd_DirtyMax
+static uint8_t Lcd_DirtyMin[LCD_VERTICAL_MAX];
+static uint8_t Lcd_DirtyMax[LCD_VERTICAL_MAX];
+
+//*****************************************************************************
+//
+// The flush sends the rows with the DMA (HAL_LCD_writeDataAsync()) and
+// returns at once, so that the CPU can go on, e.g. with the search, while the
+// display is updated.  Each row is translated in Lcd_LineBuffer, and the
+// completion of its transfer, in interrupt context, translates and starts the
+// next one.  The drawing functions wait for the flush to end before they
+// change the framebuffer.
+//
+//*****************************************************************************
+static volatile bool Lcd_Flushing;
+static int16_t Lcd_FlushRow;        // next row to send
+static int16_t Lcd_FlushLastRow;    // last row of the window being sent
+static uint8_t Lcd_FlushX0, Lcd_FlushX1;
+static uint8_t Lcd_LineBuffer[LCD_HORIZONTAL_MAX * 2];
+
+static void Crystalfontz128x128_FlushWait(void)
+{
+    while (Lcd_Flushing)
+    {
+        HAL_LCD_waitIdle();
+    }
+}
+
+static void Crystalfontz128x128_FramebufferInit(uint16_t ulValue)
+{
+    int16_t y;
+
+    // the panel memory was just filled with ulValue, the framebuffer matches it
+    Lcd_Palette[0] = ulValue;
+    Lcd_PaletteUsed = 1;
+    for (y = 0; y < LCD_VERTICAL_MAX; y++)
+    {
+        memset(Lcd_Framebuffer[y], 0, sizeof(Lcd_Framebuffer[y]));
+        Lcd_DirtyMin[y] = LCD_HORIZONTAL_MAX - 1;
+        Lcd_DirtyMax[y] = 0;
+    }
+}
+
+// distance between two 5-6-5 colors, sum of the squared channel differences
+static uint32_t Crystalfontz128x128_ColorDistance(uint16_t a, uint16_t b)
+{
+    int32_t r = (int32_t)(a >> 11) - (int32_t)(b >> 11);
+    int32_t g = (int32_t)((a >> 5) & 0x3F) - (int32_t)((b >> 5) & 0x3F);
+    int32_t bl = (int32_t)(a & 0x1F) - (int32_t)(b & 0x1F);
+    return (uint32_t)(4 * r * r + g * g + 4 * bl * bl);
+}
+
+// palette index of a color, added to the palette if there is room
+static uint8_t Crystalfontz128x128_PaletteIndex(uint16_t ulValue)
+{
+    uint8_t i, best = 0;
+
+    for (i = 0; i < Lcd_PaletteUsed; i++)
+    {
+        if (Lcd_Palette[i] == ulValue)
+        {
+            return i;
+        }
+    }
+    if (Lcd_PaletteUsed < LCD_PALETTE_SIZE)
+    {
+        Lcd_Palette[Lcd_PaletteUsed] = ulValue;
+        return Lcd_PaletteUsed++;
+    }
+    for (i = 1; i < LCD_PALETTE_SIZE; i++)
+    {
+        if (Crystalfontz128x128_ColorDistance(Lcd_Palette[i], ulValue) <
+            Crystalfontz128x128_ColorDistance(Lcd_Palette[best], ulValue))
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// the caller waits for the flush in progress with Crystalfontz128x128_FlushWait()
+static void Crystalfontz128x128_FramebufferSet(int16_t lX, int16_t lY, uint8_t index)
+{
+    uint8_t *cell = &Lcd_Framebuffer[lY][lX >> 1];
+    uint8_t shift = (lX & 1) ? 0 : 4;
+
+    if (((*cell >> shift) & 0x0F) == index)
+    {
+        return;
+    }
+    *cell = (uint8_t)((*cell & ~(0x0F << shift)) | (index << shift));
+    if (lX < Lcd_DirtyMin[lY]) Lcd_DirtyMin[lY] = (uint8_t)lX;
+    if (lX > Lcd_DirtyMax[lY]) Lcd_DirtyMax[lY] = (uint8_t)lX;
+}
+
+static void Crystalfontz128x128_FramebufferFill(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t ulValue)
+{
+    uint8_t index = Crystalfontz128x128_PaletteIndex(ulValue);
+    int16_t x, y;
+
+    Crystalfontz128x128_FlushWait();
+    for (y = y0; y <= y1; y++)
+    {
+        for (x = x0; x <= x1; x++)
+        {
+            Crystalfontz128x128_FramebufferSet(x, y, index);
+        }
+    }
+}
+#endif
+
+//*****************************************************************************
+//
+// Draw frame cache.  The controller keeps its address window (CASET and
+// RASET) until the next one, and after RAMWR it writes the pixel data at
+// consecutive addresses of the window, left to right then top to bottom,
+// until the next command.  The driver remembers both, so that SetDrawFrame()
+// only sends the addresses that change, and a primitive whose pixels are the
+// next ones of the open RAMWR stream, e.g. the next run of a row of text or
+// the next row of an image, only sends its pixel data.
+//
+// The window is kept in display coordinates with the orientation it was set
+// for.  The cache assumes that only this driver talks to the controller.
+//
+//*****************************************************************************
+static bool Lcd_WindowValid;
+static uint8_t Lcd_WindowOrientation;
+static uint16_t Lcd_WindowX0, Lcd_WindowY0, Lcd_WindowX1, Lcd_WindowY1;
+
+// RAMWR was the last command, its next pixel goes to Lcd_StreamX, Lcd_StreamY
+static bool Lcd_StreamOpen;
+static uint16_t Lcd_StreamX, Lcd_StreamY;
+
+//*****************************************************************************
+//
+// Prepares the controller for the pixels of the rectangle x0..x1, y0..y1,
+// sent left to right then top to bottom.  Nothing is sent if they are the
+// next pixels of the open RAMWR stream.  Otherwise a window is opened at
+// x0, y0 and RAMWR is sent: the window extends to the bottom of the screen,
+// and with bRow, for a single row, to its right edge too, so that the next
+// row of a block, or the next run of a row, can continue the stream.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_StartPixels(uint16_t x0, uint16_t y0,
+                                            uint16_t x1, uint16_t y1,
+                                            bool bRow)
+{
+    if (Lcd_StreamOpen && Lcd_WindowOrientation == Lcd_Orientation &&
+        Lcd_StreamX == x0 && Lcd_StreamY == y0 &&
+        x1 <= Lcd_WindowX1 && y1 <= Lcd_WindowY1 &&
+        (y0 == y1 || (x0 == Lcd_WindowX0 && x1 == Lcd_WindowX1)))
+    {
+        return;
+    }
+
+    Crystalfontz128x128_SetDrawFrame(x0, y0, bRow ? LCD_HORIZONTAL_MAX - 1 : x1,
+                                     LCD_VERTICAL_MAX - 1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+    Lcd_StreamOpen = true;
+    Lcd_StreamX = x0;
+    Lcd_StreamY = y0;
+}
+
+// moves the stream past ulCount pixels, wrapping inside the window like the
+// controller does
+static void Crystalfontz128x128_AdvancePixels(uint32_t ulCount)
+{
+    uint32_t ulWidth = Lcd_WindowX1 - Lcd_WindowX0 + 1;
+    uint32_t ulIndex = (uint32_t)(Lcd_StreamY - Lcd_WindowY0) * ulWidth +
+                       (Lcd_StreamX - Lcd_WindowX0) + ulCount;
+
+    ulIndex %= ulWidth * (Lcd_WindowY1 - Lcd_WindowY0 + 1);
+    Lcd_StreamX = (uint16_t)(Lcd_WindowX0 + ulIndex % ulWidth);
+    Lcd_StreamY = (uint16_t)(Lcd_WindowY0 + ulIndex / ulWidth);
+}
+
 //*****************************************************************************
 //
 //! Initializes the display driver.
@@ -62,10 +262,12 @@ void Crystalfontz128x128_Init(void)
     HAL_LCD_PortInit();
     HAL_LCD_SpiInit();
 
-    GPIO_setOutputLowOnPin(LCD_RST_PORT, LCD_RST_PIN);
+    HAL_lcd_set_pin(HAL_LCD_PIN_RST, false);
     HAL_LCD_delay(50);
-    GPIO_setOutputHighOnPin(LCD_RST_PORT, LCD_RST_PIN);
+    HAL_lcd_set_pin(HAL_LCD_PIN_RST, true);
     HAL_LCD_delay(120);
+    Lcd_WindowValid = false;
+    Lcd_StreamOpen = false;
 
     HAL_LCD_writeCommand(CM_SLPOUT);
     HAL_LCD_delay(200);
@@ -97,22 +299,49 @@ void Crystalfontz128x128_Init(void)
     Lcd_FlagRead  = 0;
     Lcd_TouchTrim = 0;
 
-    Crystalfontz128x128_SetDrawFrame(0, 0, 127, 127);
-    HAL_LCD_writeCommand(CM_RAMWR);
-    int i;
-    for (i = 0; i < 16384; i++)
-    {
-        HAL_LCD_writeData(0xFF);
-        HAL_LCD_writeData(0xFF);
-    }
+    Crystalfontz128x128_StartPixels(0, 0, 127, 127, false);
+    HAL_LCD_fillPixels(0xFFFF, 16384);
+    Crystalfontz128x128_AdvancePixels(16384);
+
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FramebufferInit(0xFFFF);
+#endif
 
     HAL_LCD_delay(10);
     HAL_LCD_writeCommand(CM_DISPON);
 }
 
 
+//*****************************************************************************
+//
+//! Sets the address window of the next RAMWR.
+//!
+//! \param x0 is the X coordinate of the left column of the window.
+//! \param y0 is the Y coordinate of the top row of the window.
+//! \param x1 is the X coordinate of the right column of the window.
+//! \param y1 is the Y coordinate of the bottom row of the window.
+//!
+//! The columns (CASET) and the rows (RASET) are only sent when they differ
+//! from those of the window the controller already has.  The caller sends
+//! RAMWR after it, which starts at the top left corner of the window.
+//!
+//! \return None.
+//
+//*****************************************************************************
 void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
+    bool bSame = Lcd_WindowValid && Lcd_WindowOrientation == Lcd_Orientation;
+    bool bColumns = !bSame || x0 != Lcd_WindowX0 || x1 != Lcd_WindowX1;
+    bool bRows = !bSame || y0 != Lcd_WindowY0 || y1 != Lcd_WindowY1;
+
+    Lcd_WindowValid = true;
+    Lcd_WindowOrientation = Lcd_Orientation;
+    Lcd_WindowX0 = x0;
+    Lcd_WindowY0 = y0;
+    Lcd_WindowX1 = x1;
+    Lcd_WindowY1 = y1;
+    Lcd_StreamOpen = false;
+
     switch (Lcd_Orientation) {
         case 0:
             x0 += 2;
@@ -142,17 +371,23 @@ void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uin
             break;
     }
 
-    HAL_LCD_writeCommand(CM_CASET);
-    HAL_LCD_writeData((uint8_t)(x0 >> 8));
-    HAL_LCD_writeData((uint8_t)(x0));
-    HAL_LCD_writeData((uint8_t)(x1 >> 8));
-    HAL_LCD_writeData((uint8_t)(x1));
-
-    HAL_LCD_writeCommand(CM_RASET);
-    HAL_LCD_writeData((uint8_t)(y0 >> 8));
-    HAL_LCD_writeData((uint8_t)(y0));
-    HAL_LCD_writeData((uint8_t)(y1 >> 8));
-    HAL_LCD_writeData((uint8_t)(y1));
+    if (bColumns)
+    {
+        HAL_LCD_writeCommand(CM_CASET);
+        HAL_LCD_writeData((uint8_t)(x0 >> 8));
+        HAL_LCD_writeData((uint8_t)(x0));
+        HAL_LCD_writeData((uint8_t)(x1 >> 8));
+        HAL_LCD_writeData((uint8_t)(x1));
+    }
+
+    if (bRows)
+    {
+        HAL_LCD_writeCommand(CM_RASET);
+        HAL_LCD_writeData((uint8_t)(y0 >> 8));
+        HAL_LCD_writeData((uint8_t)(y0));
+        HAL_LCD_writeData((uint8_t)(y1 >> 8));
+        HAL_LCD_writeData((uint8_t)(y1));
+    }
 }
 
 
@@ -173,7 +408,13 @@ void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uin
 //*****************************************************************************
 void Crystalfontz128x128_SetOrientation(uint8_t orientation)
 {
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FlushWait();
+#endif
+    // MADCTL ends the RAMWR stream, the window is resent for the new
+    // orientation by the next SetDrawFrame()
     Lcd_Orientation = orientation;
+    Lcd_StreamOpen = false;
     HAL_LCD_writeCommand(CM_MADCTL);
     switch (Lcd_Orientation) {
         case LCD_ORIENTATION_UP:
@@ -213,15 +454,52 @@ static void Crystalfontz128x128_PixelDraw(const Graphics_Display *pDisplay,
                                           int16_t lY,
                                           uint16_t ulValue)
 {
-
-    Crystalfontz128x128_SetDrawFrame(lX,lY,lX,lY);
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FlushWait();
+    Crystalfontz128x128_FramebufferSet(lX, lY, Crystalfontz128x128_PaletteIndex(ulValue));
+#else
+    Crystalfontz128x128_StartPixels(lX, lY, lX, lY, true);
 
     //
     // Write the pixel value.
     //
-    HAL_LCD_writeCommand(CM_RAMWR);
-    HAL_LCD_writeData(ulValue>>8);
-    HAL_LCD_writeData(ulValue);
+    HAL_LCD_fillPixels(ulValue, 1);
+    Crystalfontz128x128_AdvancePixels(1);
+#endif
+}
+
+
+//*****************************************************************************
+//
+// Translates pixel i of a horizontal sequence of PixelDrawMultiple() to the
+// display color.  lX0 is the offset of the first pixel in the first byte of
+// pucData.  For 1 bit per pixel the palette holds translated colors; for 4
+// and 8 bits per pixel the color is read as a 16-bit value from the palette
+// entry, like the graphics library stores it; 16 bits per pixel is the native
+// format of the display.
+//
+//*****************************************************************************
+static inline uint16_t Crystalfontz128x128_PixelValue(int16_t lX0,
+                                                     int16_t i,
+                                                     int16_t lBPP,
+                                                     const uint8_t *pucData,
+                                                     const uint32_t *pucPalette)
+{
+    int16_t bit;
+
+    switch (lBPP)
+    {
+        case 1:
+            bit = lX0 + i;
+            return (uint16_t)pucPalette[(pucData[bit >> 3] >> (7 - (bit & 7))) & 1];
+        case 4:
+            bit = (lX0 & 1) + i;
+            return *(const uint16_t *)(pucPalette + ((pucData[bit >> 1] >> ((bit & 1) ? 0 : 4)) & 15));
+        case 8:
+            return *(const uint16_t *)(pucPalette + pucData[i]);
+        default:
+            return ((const uint16_t *)pucData)[i];
+    }
 }
 
 
@@ -259,140 +537,45 @@ static void Crystalfontz128x128_PixelDrawMultiple(const Graphics_Display *pDispl
                                                   const uint8_t *pucData,
                                                   const uint32_t *pucPalette)
 {
-    uint16_t Data;
+    int16_t i;
+
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FlushWait();
+    for (i = 0; i < lCount; i++)
+    {
+        uint16_t Data = Crystalfontz128x128_PixelValue(lX0, i, lBPP, pucData, pucPalette);
+        Crystalfontz128x128_FramebufferSet(lX + i, lY, Crystalfontz128x128_PaletteIndex(Data));
+    }
+#else
+    uint16_t pixels[LCD_PIXEL_CHUNK];
+    int16_t n = 0;
 
     //
-    // Set the cursor increment to left to right, followed by top to bottom.
+    // Set the cursor increment to left to right, followed by top to bottom,
+    // in a window as wide as the sequence so that the sequence of the next
+    // row, e.g. of an image, continues the stream.
     //
-    Crystalfontz128x128_SetDrawFrame(lX,lY,lX+lCount,127);
-    HAL_LCD_writeCommand(CM_RAMWR);
+    Crystalfontz128x128_StartPixels(lX, lY, lX + lCount - 1, lY, false);
 
     //
-    // Determine how to interpret the pixel data based on the number of bits
-    // per pixel.
+    // Translate the pixels a chunk at a time and send each chunk in one
+    // transaction.
     //
-    switch(lBPP)
+    for (i = 0; i < lCount; i++)
     {
-        // The pixel data is in 1 bit per pixel format
-        case 1:
+        pixels[n++] = Crystalfontz128x128_PixelValue(lX0, i, lBPP, pucData, pucPalette);
+        if (n == LCD_PIXEL_CHUNK)
         {
-            // Loop while there are more pixels to draw
-            while(lCount > 0)
-            {
-                // Get the next byte of image data
-                Data = *pucData++;
-
-                // Loop through the pixels in this byte of image data
-                for(; (lX0 < 8) && lCount; lX0++, lCount--)
-                {
-                    // Draw this pixel in the appropriate color
-                    HAL_LCD_writeData((((uint32_t *)pucPalette)[(Data >>
-                                                             (7 - lX0)) & 1])>>8);
-                    HAL_LCD_writeData(((uint32_t *)pucPalette)[(Data >>
-                                                             (7 - lX0)) & 1]);
-                }
-
-                // Start at the beginning of the next byte of image data
-                lX0 = 0;
-            }
-            // The image data has been drawn
-
-            break;
-        }
-
-        // The pixel data is in 4 bit per pixel format
-        case 4:
-        {
-            // Loop while there are more pixels to draw.  "Duff's device" is
-            // used to jump into the middle of the loop if the first nibble of
-            // the pixel data should not be used.  Duff's device makes use of
-            // the fact that a case statement is legal anywhere within a
-            // sub-block of a switch statement.  See
-            // http://en.wikipedia.org/wiki/Duff's_device for detailed
-            // information about Duff's device.
-            switch(lX0 & 1)
-            {
-                case 0:
-
-                    while(lCount)
-                    {
-                        // Get the upper nibble of the next byte of pixel data
-                        // and extract the corresponding entry from the palette
-                        Data = (*pucData >> 4);
-                        Data = (*(uint16_t *)(pucPalette + Data));
-                        // Write to LCD screen
-                        HAL_LCD_writeData(Data>>8);
-                        HAL_LCD_writeData(Data);
-
-                        // Decrement the count of pixels to draw
-                        lCount--;
-
-                        // See if there is another pixel to draw
-                        if(lCount)
-                        {
-                case 1:
-                            // Get the lower nibble of the next byte of pixel
-                            // data and extract the corresponding entry from
-                            // the palette
-                            Data = (*pucData++ & 15);
-                            Data = (*(uint16_t *)(pucPalette + Data));
-                            // Write to LCD screen
-                            HAL_LCD_writeData(Data>>8);
-                            HAL_LCD_writeData(Data);
-
-                            // Decrement the count of pixels to draw
-                            lCount--;
-                        }
-                    }
-            }
-            // The image data has been drawn.
-
-            break;
-        }
-
-        // The pixel data is in 8 bit per pixel format
-        case 8:
-        {
-            // Loop while there are more pixels to draw
-            while(lCount--)
-            {
-                // Get the next byte of pixel data and extract the
-                // corresponding entry from the palette
-                Data = *pucData++;
-                Data = (*(uint16_t *)(pucPalette + Data));
-                // Write to LCD screen
-                HAL_LCD_writeData(Data>>8);
-                HAL_LCD_writeData(Data);
-            }
-            // The image data has been drawn
-            break;
-        }
-
-        //
-        // We are being passed data in the display's native format.  Merely
-        // write it directly to the display.  This is a special case which is
-        // not used by the graphics library but which is helpful to
-        // applications which may want to handle, for example, JPEG images.
-        //
-        case 16:
-        {
-            uint16_t usData;
-
-            // Loop while there are more pixels to draw.
-
-            while(lCount--)
-            {
-                // Get the next byte of pixel data and extract the
-                // corresponding entry from the palette
-                usData = *((uint16_t *)pucData);
-                pucData += 2;
-
-                // Translate this palette entry and write it to the screen
-                HAL_LCD_writeData(usData>>8);
-                HAL_LCD_writeData(usData);
-            }
+            HAL_LCD_writePixels(pixels, n);
+            n = 0;
         }
     }
+    if (n)
+    {
+        HAL_LCD_writePixels(pixels, n);
+    }
+    Crystalfontz128x128_AdvancePixels(lCount);
+#endif
 }
 
 
@@ -419,20 +602,17 @@ static void Crystalfontz128x128_LineDrawH(const Graphics_Display *pDisplay,
                                           int16_t lY,
                                           uint16_t ulValue)
 {
-
-
-    Crystalfontz128x128_SetDrawFrame(lX1, lY, lX2, lY);
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FramebufferFill(lX1, lY, lX2, lY, ulValue);
+#else
+    Crystalfontz128x128_StartPixels(lX1, lY, lX2, lY, true);
 
     //
     // Write the pixel value.
     //
-    int16_t i;
-    HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lX1; i <= lX2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    HAL_LCD_fillPixels(ulValue, lX2 - lX1 + 1);
+    Crystalfontz128x128_AdvancePixels(lX2 - lX1 + 1);
+#endif
 }
 
 
@@ -459,18 +639,17 @@ static void Crystalfontz128x128_LineDrawV(const Graphics_Display *pDisplay,
                                           int16_t lY2,
                                           uint16_t ulValue)
 {
-    Crystalfontz128x128_SetDrawFrame(lX, lY1, lX, lY2);
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FramebufferFill(lX, lY1, lX, lY2, ulValue);
+#else
+    Crystalfontz128x128_StartPixels(lX, lY1, lX, lY2, false);
 
     //
     // Write the pixel value.
     //
-    int16_t i;
-    HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lY1; i <= lY2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    HAL_LCD_fillPixels(ulValue, lY2 - lY1 + 1);
+    Crystalfontz128x128_AdvancePixels(lY2 - lY1 + 1);
+#endif
 }
 
 
@@ -500,19 +679,17 @@ static void Crystalfontz128x128_RectFill(const Graphics_Display *pDisplay,
     int16_t y0 = pRect->sYMin;
     int16_t y1 = pRect->sYMax;
 
-    Crystalfontz128x128_SetDrawFrame(x0, y0, x1, y1);
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FramebufferFill(x0, y0, x1, y1, ulValue);
+#else
+    Crystalfontz128x128_StartPixels(x0, y0, x1, y1, false);
 
     //
     // Write the pixel value.
     //
-    int16_t i;
-    int16_t pixels = (x1 - x0 + 1) * (y1 - y0 + 1);
-    HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = 0; i <= pixels; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    HAL_LCD_fillPixels(ulValue, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+    Crystalfontz128x128_AdvancePixels((uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+#endif
 }
 
 //*****************************************************************************
@@ -544,6 +721,136 @@ static uint32_t Crystalfontz128x128_ColorTranslate(const Graphics_Display *pDisp
 }
 
 
+//*****************************************************************************
+//
+//! Draws a 1 bit per pixel bitmap in one window.
+//!
+//! \param lX is the X coordinate of the top left corner of the bitmap.
+//! \param lY is the Y coordinate of the top left corner of the bitmap.
+//! \param lWidth is the width of the bitmap in pixels.
+//! \param lHeight is the height of the bitmap in pixels.
+//! \param pucData is a pointer to the rows of the bitmap, every row starting
+//! on a byte with the leftmost pixel in the most significant bit.
+//! \param ulForeground is the 24-bit RGB color of the set bits.
+//! \param ulBackground is the 24-bit RGB color of the clear bits.
+//!
+//! This function draws a bitmap, e.g. a text rendered offline, without going
+//! through the graphics library: the whole bitmap is sent in a single draw
+//! frame window, instead of a window for every row of every glyph.  With
+//! LCD_FRAMEBUFFER the bitmap is drawn in the framebuffer like the other
+//! primitives, and only the pixels that change are sent by the next flush.
+//! The bitmap is assumed to be within the extents of the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_DrawBitmap(int16_t lX, int16_t lY, int16_t lWidth, int16_t lHeight,
+                                    const uint8_t *pucData, uint32_t ulForeground, uint32_t ulBackground)
+{
+    uint16_t usColors[2];
+    int16_t lRowBytes = (lWidth + 7) / 8;
+    int16_t x, y;
+
+    usColors[0] = (uint16_t)Crystalfontz128x128_ColorTranslate(0, ulBackground);
+    usColors[1] = (uint16_t)Crystalfontz128x128_ColorTranslate(0, ulForeground);
+
+#if LCD_FRAMEBUFFER
+    uint8_t ucIndexes[2];
+
+    ucIndexes[0] = Crystalfontz128x128_PaletteIndex(usColors[0]);
+    ucIndexes[1] = Crystalfontz128x128_PaletteIndex(usColors[1]);
+    Crystalfontz128x128_FlushWait();
+    for (y = 0; y < lHeight; y++)
+    {
+        const uint8_t *pucRow = pucData + y * lRowBytes;
+        for (x = 0; x < lWidth; x++)
+        {
+            Crystalfontz128x128_FramebufferSet(lX + x, lY + y,
+                                               ucIndexes[(pucRow[x >> 3] >> (7 - (x & 7))) & 1]);
+        }
+    }
+#else
+    uint16_t pixels[LCD_PIXEL_CHUNK];
+    int16_t n = 0;
+
+    Crystalfontz128x128_StartPixels(lX, lY, lX + lWidth - 1, lY + lHeight - 1, false);
+    for (y = 0; y < lHeight; y++)
+    {
+        const uint8_t *pucRow = pucData + y * lRowBytes;
+        for (x = 0; x < lWidth; x++)
+        {
+            pixels[n++] = usColors[(pucRow[x >> 3] >> (7 - (x & 7))) & 1];
+            if (n == LCD_PIXEL_CHUNK)
+            {
+                HAL_LCD_writePixels(pixels, n);
+                n = 0;
+            }
+        }
+    }
+    if (n)
+    {
+        HAL_LCD_writePixels(pixels, n);
+    }
+    Crystalfontz128x128_AdvancePixels((uint32_t)lWidth * lHeight);
+#endif
+}
+
+
+#if LCD_FRAMEBUFFER
+//*****************************************************************************
+//
+// Sends the next dirty row, called by the flush for the first one and then
+// by the completion of every transfer.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FlushNext(void)
+{
+    int16_t y = Lcd_FlushRow;
+    int16_t x;
+    uint8_t *p = Lcd_LineBuffer;
+
+    if (y > Lcd_FlushLastRow)
+    {
+        // the window is done: the next one starts at the next dirty row and
+        // covers the rows below it with the same span
+        while (y < LCD_VERTICAL_MAX && Lcd_DirtyMin[y] > Lcd_DirtyMax[y])
+        {
+            y++;
+        }
+        if (y == LCD_VERTICAL_MAX)
+        {
+            Lcd_Flushing = false;
+            return;
+        }
+        Lcd_FlushX0 = Lcd_DirtyMin[y];
+        Lcd_FlushX1 = Lcd_DirtyMax[y];
+        Lcd_FlushLastRow = y;
+        while (Lcd_FlushLastRow + 1 < LCD_VERTICAL_MAX &&
+               Lcd_DirtyMin[Lcd_FlushLastRow + 1] == Lcd_FlushX0 &&
+               Lcd_DirtyMax[Lcd_FlushLastRow + 1] == Lcd_FlushX1)
+        {
+            Lcd_FlushLastRow++;
+        }
+
+        Crystalfontz128x128_StartPixels(Lcd_FlushX0, y, Lcd_FlushX1, Lcd_FlushLastRow, false);
+    }
+
+    for (x = Lcd_FlushX0; x <= Lcd_FlushX1; x++)
+    {
+        uint16_t ulValue = Lcd_Palette[(Lcd_Framebuffer[y][x >> 1] >> ((x & 1) ? 0 : 4)) & 0x0F];
+        *p++ = (uint8_t)(ulValue >> 8);
+        *p++ = (uint8_t)ulValue;
+    }
+    Lcd_DirtyMin[y] = LCD_HORIZONTAL_MAX - 1;
+    Lcd_DirtyMax[y] = 0;
+    Lcd_FlushRow = y + 1;
+    Crystalfontz128x128_AdvancePixels(Lcd_FlushX1 - Lcd_FlushX0 + 1);
+
+    HAL_LCD_writeDataAsync(Lcd_LineBuffer, (uint16_t)(p - Lcd_LineBuffer), Crystalfontz128x128_FlushNext);
+}
+#endif
+
+
 //*****************************************************************************
 //
 //! Flushes any cached drawing operations.
@@ -551,10 +858,11 @@ static uint32_t Crystalfontz128x128_ColorTranslate(const Graphics_Display *pDisp
 //! \param pDisplay is a pointer to the driver-specific data for this
 //! display driver.
 //!
-//! This functions flushes any cached drawing operations to the display.  This
-//! is useful when a local frame buffer is used for drawing operations, and the
-//! flush would copy the local frame buffer to the display.  For the SSD2119
-//! driver, the flush is a no operation.
+//! This functions flushes any cached drawing operations to the display.  With
+//! LCD_FRAMEBUFFER the changed span of every row is sent, consecutive rows
+//! with the same span in one window, by the DMA: the function returns before
+//! the display is updated.  Without it the drawing functions write to the
+//! display directly and the flush is a no operation.
 //!
 //! \return None.
 //
@@ -562,9 +870,13 @@ static uint32_t Crystalfontz128x128_ColorTranslate(const Graphics_Display *pDisp
 static void
 Crystalfontz128x128_Flush(const Graphics_Display *pDisplay)
 {
-    //
-    // There is nothing to be done.
-    //
+#if LCD_FRAMEBUFFER
+    Crystalfontz128x128_FlushWait();
+    Lcd_Flushing = true;
+    Lcd_FlushRow = 0;
+    Lcd_FlushLastRow = -1;
+    Crystalfontz128x128_FlushNext();
+#endif
 }
 
 
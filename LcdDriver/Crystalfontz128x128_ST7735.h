@@ -41,13 +41,26 @@
 
 
 #include <stdint.h>
+// DriverLib is only needed by the MSP432 backend, the host builds the driver with HOST_LCD
+#ifndef HOST_BUILD
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#endif
 #include <ti/grlib/grlib.h>
 
 // LCD Screen Dimensions
 #define LCD_VERTICAL_MAX                   128
 #define LCD_HORIZONTAL_MAX                 128
 
+// off-screen framebuffer with dirty rectangles, see Crystalfontz128x128_ST7735.c
+// define LCD_FRAMEBUFFER to 0 in the compiler options to draw directly on the panel and save its 8 KB of RAM
+#ifndef LCD_FRAMEBUFFER
+#define LCD_FRAMEBUFFER 1
+#endif
+// colors the framebuffer can hold at once, it stores 4-bit indexes
+#define LCD_PALETTE_SIZE 16
+// pixels PixelDrawMultiple() translates on the stack before sending them in one transaction, without the framebuffer
+#define LCD_PIXEL_CHUNK 32
+
 #define LCD_ORIENTATION_UP    0
 #define LCD_ORIENTATION_LEFT  1
 #define LCD_ORIENTATION_DOWN  2
@@ -107,6 +120,9 @@ extern void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t
 
 extern void Crystalfontz128x128_SetOrientation(uint8_t orientation);
 
+extern void Crystalfontz128x128_DrawBitmap(int16_t lX, int16_t lY, int16_t lWidth, int16_t lHeight,
+                                           const uint8_t *pucData, uint32_t ulForeground, uint32_t ulBackground);
+
 
 
 #endif /* __CRYSTALFONTZLCD_H__ */
@@ -38,42 +38,20 @@
 //*****************************************************************************
 
 #include "HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h"
-#include <ti/grlib/grlib.h>
-#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include "include/hal.h"
 #include <stdint.h>
 
+// the pins and the SPI module are driven through the HAL of the project (include/hal.h), the MSP432 backend
+// configures them with the settings of HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h
+
 void HAL_LCD_PortInit(void)
 {
-    // LCD_SCK
-    GPIO_setAsPeripheralModuleFunctionOutputPin(LCD_SCK_PORT, LCD_SCK_PIN, GPIO_PRIMARY_MODULE_FUNCTION);
-    // LCD_MOSI
-    GPIO_setAsPeripheralModuleFunctionOutputPin(LCD_MOSI_PORT, LCD_MOSI_PIN, GPIO_PRIMARY_MODULE_FUNCTION);
-    // LCD_RST
-    GPIO_setAsOutputPin(LCD_RST_PORT, LCD_RST_PIN);
-    // LCD_RS
-    GPIO_setAsOutputPin(LCD_DC_PORT, LCD_DC_PIN);
-    // LCD_CS
-    GPIO_setAsOutputPin(LCD_CS_PORT, LCD_CS_PIN);
+    HAL_lcd_port_init();
 }
 
 void HAL_LCD_SpiInit(void)
 {
-    eUSCI_SPI_MasterConfig config =
-        {
-            EUSCI_B_SPI_CLOCKSOURCE_SMCLK,
-            LCD_SYSTEM_CLOCK_SPEED,
-            LCD_SPI_CLOCK_SPEED,
-            EUSCI_B_SPI_MSB_FIRST,
-            EUSCI_B_SPI_PHASE_DATA_CAPTURED_ONFIRST_CHANGED_ON_NEXT,
-            EUSCI_B_SPI_CLOCKPOLARITY_INACTIVITY_LOW,
-            EUSCI_B_SPI_3PIN
-        };
-    SPI_initMaster(LCD_EUSCI_BASE, &config);
-    SPI_enableModule(LCD_EUSCI_BASE);
-
-    GPIO_setOutputLowOnPin(LCD_CS_PORT, LCD_CS_PIN);
-
-    GPIO_setOutputHighOnPin(LCD_DC_PORT, LCD_DC_PIN);
+    HAL_spi_init();
 }
 
 
@@ -86,19 +64,13 @@ void HAL_LCD_SpiInit(void)
 void HAL_LCD_writeCommand(uint8_t command)
 {
     // Set to command mode
-    GPIO_setOutputLowOnPin(LCD_DC_PORT, LCD_DC_PIN);
-
-    // USCI_B0 Busy? //
-    while (UCB0STATW & UCBUSY);
+    HAL_lcd_set_pin(HAL_LCD_PIN_DC, false);
 
     // Transmit data
-    UCB0TXBUF = command;
-
-    // USCI_B0 Busy? //
-    while (UCB0STATW & UCBUSY);
+    HAL_spi_write(command);
 
     // Set back to data mode
-    GPIO_setOutputHighOnPin(LCD_DC_PORT, LCD_DC_PIN);
+    HAL_lcd_set_pin(HAL_LCD_PIN_DC, true);
 }
 
 
@@ -110,14 +82,56 @@ void HAL_LCD_writeCommand(uint8_t command)
 //*****************************************************************************
 void HAL_LCD_writeData(uint8_t data)
 {
-    // USCI_B0 Busy? //
-    while (UCB0STATW & UCBUSY);
-
     // Transmit data
-    UCB0TXBUF = data;
+    HAL_spi_write(data);
+}
+
+
+//*****************************************************************************
+//
+// Writes a block of 16-bit pixels to the CFAF128128B-0145T, high byte first,
+// in one SPI transaction.
+//
+//*****************************************************************************
+void HAL_LCD_writePixels(const uint16_t *pixels, uint32_t count)
+{
+    HAL_spi_write_pixels(pixels, count);
+}
+
 
-    // USCI_B0 Busy? //
-    while (UCB0STATW & UCBUSY);
+//*****************************************************************************
+//
+// Writes the same 16-bit pixel count times to the CFAF128128B-0145T, in one
+// SPI transaction.
+//
+//*****************************************************************************
+void HAL_LCD_fillPixels(uint16_t pixel, uint32_t count)
+{
+    HAL_spi_fill(pixel, count);
+}
+
+
+//*****************************************************************************
+//
+// Starts writing a buffer of data to the CFAF128128B-0145T with the DMA and
+// returns at once.  done is called in interrupt context when it has been sent,
+// the buffer must not change until then.
+//
+//*****************************************************************************
+void HAL_LCD_writeDataAsync(const uint8_t *data, uint16_t length, HAL_SpiDoneHandler_t done)
+{
+    HAL_spi_write_async(data, length, done);
+}
+
+
+//*****************************************************************************
+//
+// Waits for the asynchronous writes in progress to end.
+//
+//*****************************************************************************
+void HAL_LCD_waitIdle(void)
+{
+    HAL_spi_wait();
 }
 
 //*****************************************************************************
@@ -154,7 +168,7 @@ SysCtlDelay(uint32_t ui32Count)
           "    bx      lr");
 }
 #endif
-#if defined(codered) || defined( __GNUC__ ) || defined(sourcerygxx)
+#if (defined(codered) || defined( __GNUC__ ) || defined(sourcerygxx)) && !defined(HOST_BUILD)
 void __attribute__((naked))
 SysCtlDelay(uint32_t ui32Count)
 {
@@ -42,7 +42,11 @@
 
 
 #include <stdint.h>
+// DriverLib is only needed by the MSP432 backend, the host builds the driver with HOST_LCD
+#ifndef HOST_BUILD
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#endif
+#include "include/hal.h"
 //*****************************************************************************
 //
 // User Configuration for the LCD Driver
@@ -80,16 +84,21 @@
 //*****************************************************************************
 extern void HAL_LCD_writeCommand(uint8_t command);
 extern void HAL_LCD_writeData(uint8_t data);
+extern void HAL_LCD_writePixels(const uint16_t *pixels, uint32_t count);
+extern void HAL_LCD_fillPixels(uint16_t pixel, uint32_t count);
+extern void HAL_LCD_writeDataAsync(const uint8_t *data, uint16_t length, HAL_SpiDoneHandler_t done);
+extern void HAL_LCD_waitIdle(void);
 extern void HAL_LCD_PortInit(void);
 extern void HAL_LCD_SpiInit(void);
 
 // Custom __delay_cycles() for non CCS Compiler
-#if !defined( __TI_ARM__ )
+#if !defined( __TI_ARM__ ) && !defined(HOST_BUILD)
 #undef __delay_cycles
 #define __delay_cycles(x)     SysCtlDelay(x)
 void SysCtlDelay(uint32_t);
 #endif
 
-#define HAL_LCD_delay(x)      __delay_cycles(x * 48)
+// delays of the ST7735 power up sequence, in milliseconds whatever the MCLK frequency (see include/hal.h)
+#define HAL_LCD_delay(x)      HAL_delay_ms(x)
 
 #endif /* HAL_MSP_EXP432P401R_CRYSTALFONTZ128X128_ST7735_H_ */
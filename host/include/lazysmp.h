@@ -0,0 +1,61 @@
+/*
+ * lazysmp.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "include/connect4algorithm.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef HOST_LAZYSMP_H_
+#define HOST_LAZYSMP_H_
+
+
+/* parallel search for host builds (Lazy SMP)
+ *
+ * the same root is searched by iterative_deepening() in several threads at once. the threads do not split the tree
+ * between them: they only share the transposition table of the calling thread, which is lock-free (see
+ * include/transposition.h), so every thread finds the bounds and best moves the others have stored and skips the
+ * subtrees already searched. the helper threads start one ply deeper every other thread, so that they run ahead of
+ * the main thread and fill the table for the depth it will search next.
+ *
+ * the main thread is the calling thread: it keeps the time budget and the depth limit, and stops the helpers when it
+ * is done. the result is the one of the thread that completed the deepest iteration, the main thread in a tie.
+ * the helpers copy the settings of the calling thread: search_algorithm, eval_threats and eval_weights.
+ *
+ * the firmware does not use this module, its search stays single-threaded
+ */
+
+// most threads of a search, including the calling thread
+#define SMP_MAX_THREADS 64
+
+
+/* struct type of the result of a parallel search
+ *  result:  best move and score, like iterative_deepening()
+ *  depth:   depth of the iteration the result comes from
+ *  nodes:   positions visited by all the threads together
+ *  thread:  thread the result comes from, 0 for the calling thread
+ */
+typedef struct {
+    Result_t result;
+    uint8_t depth;
+    uint64_t nodes;
+    int thread;
+} SMPResult_t;
+
+
+/// @brief Searches a position with iterative deepening in several threads.
+///
+/// @param b Pointer to the board to search, it is restored on return.
+/// @param maximizing true if the computer is to move, false for the human.
+/// @param max_depth Deepest iteration to run.
+/// @param budget_ms Wall-clock budget in milliseconds.
+/// @param threads Number of threads, including the calling thread,
+///        1 to SMP_MAX_THREADS. With 1 it is iterative_deepening().
+/// @param out Output: result of the search.
+void SMP_search(Board_t *b, bool maximizing, int max_depth, uint32_t budget_ms, int threads, SMPResult_t *out);
+
+#endif /* HOST_LAZYSMP_H_ */
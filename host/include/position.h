@@ -0,0 +1,78 @@
+/*
+ * position.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "include/bitboard.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef HOST_POSITION_H_
+#define HOST_POSITION_H_
+
+
+/* helpers used by the host tools to set up boards from move strings
+ * a move string lists the columns played from the empty board, one character per move, '1' being the leftmost column
+ * e.g. "4453" means: first player in column 4, second player in column 4, first player in column 5, second player in column 3
+ */
+
+
+/// @brief Loads a move string into an array board.
+///
+/// The moves are assigned so that the side to move after the last one
+/// is the computer (p1): the engine always plays the side to move, and
+/// minimax() is called with maximizing = true.
+/// The incremental score is updated through delta_score() exactly as
+/// during a game.
+///
+/// @param board Pointer to the board to fill, it is reinitialized first.
+/// @param moves Null-terminated move string.
+///
+/// @return Number of moves played, or -1 if the string contains an
+///         invalid character, plays in a full column or contains a
+///         move that ends the game.
+int Position_load_board(Board_t *board, const char *moves);
+
+/// @brief Loads a move string into a bitboard.
+///
+/// Same rules as Position_load_board().
+///
+/// @param b Pointer to the bitboard to fill, it is reinitialized first.
+/// @param moves Null-terminated move string.
+///
+/// @return Number of moves played, or -1 on an invalid string.
+int Position_load_bitboard(BitBoard_t *b, const char *moves);
+
+/// @brief Advances a seeded xorshift32 generator.
+///
+/// The tools generate their positions from a fixed seed so that every
+/// build sees the same corpus; the C library generator differs between
+/// platforms.
+///
+/// @param state Pointer to the state of the generator, the seed at
+///              first, never 0.
+///
+/// @return The next number of the sequence.
+uint32_t Position_rng_next(uint32_t *state);
+
+/// @brief Generates a random position of a corpus.
+///
+/// Plays random moves from the empty board, never a move that ends the
+/// game, up to the given ply.
+/// With quiet, positions where the side to move can win or has to block
+/// on the next move are rejected, since the search solves them at once.
+///
+/// @param moves Buffer of at least NUM_COLS * NUM_ROWS + 1 characters,
+///              filled with the move string.
+/// @param ply Number of moves to play.
+/// @param quiet Whether to reject the positions with an immediate threat.
+/// @param state Pointer to the state of the generator.
+///
+/// @return false on a dead end or a rejected position, the caller draws
+///         another one.
+bool Position_random(char *moves, int ply, bool quiet, uint32_t *state);
+
+#endif /* HOST_POSITION_H_ */
@@ -0,0 +1,112 @@
+/*
+ * solver.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "include/bitboard.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef HOST_SOLVER_H_
+#define HOST_SOLVER_H_
+
+
+/* exact connect 4 solver for host builds
+ *
+ * unlike minimax(), which stops at a fixed depth and returns a heuristic score, the solver searches every line down to
+ * the end of the game and returns the game-theoretic result of the position with perfect play from both sides.
+ * it works on the bitboard engine (bitboard.h) and uses:
+ * - negamax with alpha-beta on a score that encodes how early the game ends
+ * - a transposition table of lower and upper bounds, large enough to hold several million positions
+ * - moves that let the opponent win immediately are never searched, forced moves are searched alone
+ * - moves are ordered by the number of winning cells they create, then center first
+ * - a null-window search converging on the score, as in MTD(f)
+ *
+ * score of a position, from the point of view of the player to move:
+ *  0   the game ends in a draw
+ *  >0  the player to move wins: the score is 22 minus the number of pieces the winner has when they connect 4,
+ *      so quicker wins get higher scores (1 means a win with the 21st piece, 18 a win with the 4th piece)
+ *  <0  the player to move loses, with the same encoding for the opponent's win
+ */
+
+// highest possible score: a win with the 4th piece
+#define SOLVER_MAX_SCORE ((NUM_COLS * NUM_ROWS + 1) / 2 - 3)
+#define SOLVER_MIN_SCORE (-(NUM_COLS * NUM_ROWS) / 2 + 3)
+
+// value given by Solver_analyze() to full columns
+#define SOLVER_INVALID_SCORE (-100)
+
+
+/* struct type of the result of a solve
+ *  score:  solver score of the position, see above. for a weak solve only its sign is meaningful: -1, 0 or 1
+ *  result: 1 if the player to move wins, 0 for a draw, -1 if the player to move loses
+ *  plies:  number of moves left until the game ends with perfect play, including the winning move
+ *          (strong solve only, 0 for a weak solve)
+ *  nodes:  number of positions explored
+ */
+typedef struct {
+    int8_t score;
+    int8_t result;
+    uint8_t plies;
+    uint64_t nodes;
+} SolverResult_t;
+
+
+/// @brief Empties the solver's transposition table.
+///
+/// Results stay valid between positions of the same game, so the table
+/// only needs to be cleared to measure a solve from scratch.
+void Solver_reset(void);
+
+/// @brief Computes the exact result of a position.
+///
+/// A weak solve only decides between win, draw and loss with a (-1, 1)
+/// window, which is much faster than a strong solve, which also finds
+/// how many moves the game lasts.
+///
+/// @param b Position to solve, the player to move is b->position.
+/// @param weak true for a weak solve, false for a strong solve.
+/// @param out Output: result of the solve.
+void Solver_solve(const BitBoard_t *b, bool weak, SolverResult_t *out);
+
+/// @brief Solves every move of a position.
+///
+/// scores[c] is the score of the position for the player to move if
+/// they play column c, SOLVER_INVALID_SCORE if the column is full.
+///
+/// @param b Position to analyze.
+/// @param weak true for weak solves, false for strong solves.
+/// @param scores Output: one score per column.
+///
+/// @return Number of positions explored.
+uint64_t Solver_analyze(const BitBoard_t *b, bool weak, int8_t scores[NUM_COLS]);
+
+/// @brief Finds a best move of a position.
+///
+/// Solves the position, then tries the moves center first with a
+/// null-window search until one reaches the score of the position, so
+/// it is cheaper than Solver_analyze(). With a strong solve the move
+/// wins the fastest or loses the slowest; with a weak solve it only
+/// keeps the result.
+///
+/// @param b Position to solve, the player to move is b->position.
+/// @param weak true for a weak solve, false for a strong solve.
+/// @param out Output: result of the position, nodes include the move search.
+///
+/// @return Column of the best move.
+Col_t Solver_best_move(const BitBoard_t *b, bool weak, SolverResult_t *out);
+
+/// @brief Solves a position given as an array board.
+///
+/// Convenience wrapper that converts the board with BitBoard_from_board().
+///
+/// @param board Position to solve.
+/// @param computer_to_move true if the computer (p1) is the player to move.
+/// @param weak true for a weak solve, false for a strong solve.
+/// @param out Output: result of the solve, from the player to move's point of view.
+void Solver_solve_board(const Board_t *board, bool computer_to_move, bool weak, SolverResult_t *out);
+
+#endif /* HOST_SOLVER_H_ */
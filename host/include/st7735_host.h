@@ -0,0 +1,60 @@
+/*
+ * st7735_host.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef HOST_ST7735_HOST_H_
+#define HOST_ST7735_HOST_H_
+
+
+/* emulator of the ST7735 controller of the BoosterPack LCD, fed by the host backend of the HAL (host/source/hal_host.c)
+ *
+ * every byte sent on the SPI bus is a command or one of its parameters depending on the D/C line. the emulator decodes
+ * CASET and RASET (the address window), MADCTL (the mirroring and exchange of the addresses, i.e. the orientation)
+ * and RAMWR (16-bit 5-6-5 pixels written in the window, left to right then top to bottom) into the 132x132 memory of
+ * the controller. the other commands are counted and their parameters ignored.
+ *
+ * the screen is the 128x128 part of the memory that the panel shows, seen with the BoosterPack upright, i.e. the
+ * coordinates the LCD driver uses with LCD_ORIENTATION_UP
+ */
+
+#define ST7735_WIDTH    128
+#define ST7735_HEIGHT   128
+
+/* struct type of the traffic received since the program started
+ *  commands:   command bytes, D/C low
+ *  data_bytes: parameter and pixel bytes, D/C high
+ *  windows:    CASET and RASET commands
+ *  pixels:     pixels written by RAMWR
+ */
+typedef struct {
+    uint32_t commands;
+    uint32_t data_bytes;
+    uint32_t windows;
+    uint32_t pixels;
+} St7735Traffic_t;
+
+
+// function that resets the controller like its reset line does: black memory, default address window and MADCTL
+// the traffic counters are kept
+void St7735_reset(void);
+
+// functions that receive a byte of the SPI bus, sent with the D/C line low (command) or high (data)
+void St7735_command(uint8_t command);
+void St7735_data(uint8_t data);
+
+// function that returns the 5-6-5 color of a pixel of the screen
+uint16_t St7735_pixel(uint8_t x, uint8_t y);
+
+// function that returns the traffic received so far, callers take the difference of two calls to measure a screen
+St7735Traffic_t St7735_traffic(void);
+
+// function that writes the screen as a binary PPM image, returns false if the file cannot be written
+bool St7735_write_ppm(const char *path);
+
+#endif /* HOST_ST7735_HOST_H_ */
@@ -0,0 +1,14 @@
+/*
+ * engine_host.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* this file lets the host tools link the algorithm sources without the LCD driver and the graphics library:
+ * fn_CALCULATING_MOVE() refreshes the display before searching, on the host there is nothing to refresh
+ */
+
+#include "include/displaycontroller.h"
+
+void Display_write(void){
+}
@@ -0,0 +1,286 @@
+/*
+ * hal_host.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host backend of the hardware abstraction layer, see include/hal.h
+ *
+ * the inputs are driven by a script read from stdin, one event per line:
+ *     sensor <column>     a piece falls past the sensor of a column, 1 to 7
+ *     button1, button2    a BoosterPack button is pressed
+ * empty lines and lines starting with # are skipped. HAL_sleep() reads events until one of them wakes the processor,
+ * i.e. its input is enabled: its handler is called and HAL_sleep() returns. events on disabled inputs are ignored like
+ * the hardware would. at the end of the script the program exits, since nothing could wake it up anymore.
+ *
+ * the output is recorded on stdout: one line per input event and per text written on the display, and the SPI traffic
+ * at exit. delays return immediately so that the firmware runs at full host speed
+ *
+ * the SPI bus is connected to the emulator of the LCD controller (host/include/st7735_host.h). when the firmware is
+ * built with the LCD driver (HOST_LCD, see displaycontroller.c) the line of every text written on the display is
+ * followed by the traffic the screen cost since the previous one:
+ *     lcd: <commands> commands, <bytes> data bytes, <windows> windows, <pixels> pixels
+ * and, if the CONNECT4_FRAMES environment variable names a directory, the screen is saved there as frame-<n>.ppm
+ *
+ * asynchronous SPI transfers are checked like the DMA would need them: a transfer is only sent, and its done handler
+ * only called, when the firmware waits for it (HAL_spi_wait(), or any blocking SPI or LCD pin operation), so code
+ * that relies on it being sent earlier is caught. the program stops with an error if a transfer starts while another
+ * is in progress, or if its buffer changed before it was sent
+ *
+ * the telemetry records are written to the file named by the CONNECT4_TELEMETRY environment variable, and dropped if
+ * it is not set. a named pipe works too: opening it waits for a reader such as host/tools/decode_stats
+ */
+
+#include "include/hal.h"
+#include "host/include/st7735_host.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+
+#define MAX_LINE 256
+
+static HAL_InputHandler_t handlers[HAL_NUM_INPUTS];
+static bool enabled[HAL_NUM_INPUTS];
+
+// calls that sent SPI traffic to the LCD, the bytes are counted by the emulator
+static unsigned long spi_transactions;
+static bool lcd_data_mode;
+
+// LCD traffic when the last text was written on the display, and the number of screens saved
+static St7735Traffic_t shown;
+static unsigned frames;
+
+// asynchronous transfer in progress: the buffer, a copy taken when it started, and its done handler
+static const uint8_t *async_data;
+static uint8_t *async_copy;
+static uint16_t async_length;
+static HAL_SpiDoneHandler_t async_done;
+
+// sink of the telemetry records, NULL if there is none
+static FILE *telemetry;
+
+static void report_and_exit(void){
+    St7735Traffic_t lcd;
+
+    HAL_spi_wait();
+    printf("end of script\n");
+    lcd = St7735_traffic();
+    if (lcd.commands || lcd.data_bytes)
+        printf("spi: %lu command bytes, %lu data bytes in %lu transactions\n", (unsigned long)lcd.commands,
+               (unsigned long)lcd.data_bytes, spi_transactions);
+    exit(0);
+}
+
+// parses an event line, returns false if the line is not an event
+static bool parse_event(const char *line, HAL_Input_t *input){
+    int column;
+    if (strcmp(line, "button1") == 0) {
+        *input = HAL_INPUT_BUTTON1;
+        return true;
+    }
+    if (strcmp(line, "button2") == 0) {
+        *input = HAL_INPUT_BUTTON2;
+        return true;
+    }
+    if (sscanf(line, "sensor %d", &column) == 1 && column >= 1 && column <= HAL_INPUT_SENSOR7 + 1) {
+        *input = HAL_INPUT_SENSOR(column - 1);
+        return true;
+    }
+    return false;
+}
+
+void HAL_init(void){
+    // the recording is read together with the debug output of the search, keep them in order
+    setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+void HAL_input_init(HAL_Input_t input){
+    enabled[input] = false;
+}
+
+void HAL_input_set_handler(HAL_Input_t input, HAL_InputHandler_t handler){
+    handlers[input] = handler;
+}
+
+void HAL_input_enable(HAL_Input_t input){
+    enabled[input] = true;
+}
+
+void HAL_input_disable(HAL_Input_t input){
+    enabled[input] = false;
+}
+
+void HAL_sleep(void){
+    char line[MAX_LINE];
+
+    while (fgets(line, sizeof(line), stdin)) {
+        HAL_Input_t input;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0' || line[0] == '#') continue;
+
+        if (!parse_event(line, &input)) {
+            fprintf(stderr, "invalid event \"%s\"\n", line);
+            exit(1);
+        }
+        if (!enabled[input]) {
+            printf("input: %s (ignored)\n", line);
+            continue;
+        }
+
+        printf("input: %s\n", line);
+        if (handlers[input]) handlers[input](input);
+        return;
+    }
+    report_and_exit();
+}
+
+void HAL_sleep_until(const volatile bool *flag){
+    // the handlers only run inside HAL_sleep(), nothing can set the flag in between
+    while (!*flag) HAL_sleep();
+}
+
+uint32_t HAL_stack_peak(void){
+    // the stack of the process is not measured
+    return 0;
+}
+
+bool HAL_input_pending(void){
+    // HAL_sleep() reads the next event at once, or exits at the end of the script
+    return true;
+}
+
+void HAL_delay_us(uint32_t us){
+    (void)us;
+}
+
+void HAL_delay_ms(uint32_t ms){
+    (void)ms;
+}
+
+void HAL_timer_init(void){
+}
+
+uint32_t HAL_timer_now(void){
+    // POSIX monotonic clock, counted in microseconds
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+uint32_t HAL_timer_ticks_per_ms(void){
+    return 1000;
+}
+
+void HAL_lcd_port_init(void){
+}
+
+void HAL_spi_init(void){
+    lcd_data_mode = true;
+}
+
+static void spi_send(uint8_t data){
+    if (lcd_data_mode) St7735_data(data);
+    else St7735_command(data);
+}
+
+void HAL_spi_write(uint8_t data){
+    HAL_spi_wait();
+    spi_transactions++;
+    spi_send(data);
+}
+
+void HAL_spi_write_pixels(const uint16_t *pixels, uint32_t count){
+    HAL_spi_wait();
+    spi_transactions++;
+    while (count--) {
+        spi_send((uint8_t)(*pixels >> 8));
+        spi_send((uint8_t)*pixels++);
+    }
+}
+
+void HAL_spi_fill(uint16_t pixel, uint32_t count){
+    HAL_spi_wait();
+    spi_transactions++;
+    while (count--) {
+        spi_send((uint8_t)(pixel >> 8));
+        spi_send((uint8_t)pixel);
+    }
+}
+
+void HAL_spi_write_async(const uint8_t *data, uint16_t length, HAL_SpiDoneHandler_t done){
+    if (async_data) {
+        fprintf(stderr, "spi: transfer started while another is in progress\n");
+        exit(1);
+    }
+    if (length == 0) {
+        fprintf(stderr, "spi: empty transfer\n");
+        exit(1);
+    }
+    async_copy = realloc(async_copy, length);
+    if (!async_copy) {
+        perror("spi");
+        exit(1);
+    }
+    memcpy(async_copy, data, length);
+    spi_transactions++;
+    async_data = data;
+    async_length = length;
+    async_done = done;
+}
+
+void HAL_spi_wait(void){
+    // the done handler may start the next transfer, which is sent by the next round
+    while (async_data) {
+        HAL_SpiDoneHandler_t done = async_done;
+        uint16_t i;
+        if (memcmp(async_data, async_copy, async_length) != 0) {
+            fprintf(stderr, "spi: buffer changed while it was being sent\n");
+            exit(1);
+        }
+        for (i = 0; i < async_length; i++) spi_send(async_data[i]);
+        async_data = NULL;
+        if (done) done();
+    }
+}
+
+void HAL_lcd_set_pin(HAL_LcdPin_t pin, bool high){
+    HAL_spi_wait();
+    if (pin == HAL_LCD_PIN_DC) lcd_data_mode = high;
+    if (pin == HAL_LCD_PIN_RST && !high) St7735_reset();
+}
+
+void HAL_host_display(const char *text){
+    St7735Traffic_t now;
+    const char *dir = getenv("CONNECT4_FRAMES");
+
+    // the screen is complete once the transfers of the flush are sent
+    HAL_spi_wait();
+    printf("display: %s\n", text);
+
+    now = St7735_traffic();
+    if (now.commands == shown.commands && now.data_bytes == shown.data_bytes) return;
+    printf("lcd: %lu commands, %lu data bytes, %lu windows, %lu pixels\n",
+           (unsigned long)(now.commands - shown.commands), (unsigned long)(now.data_bytes - shown.data_bytes),
+           (unsigned long)(now.windows - shown.windows), (unsigned long)(now.pixels - shown.pixels));
+    shown = now;
+
+    if (dir && *dir) {
+        char path[MAX_LINE];
+        snprintf(path, sizeof(path), "%s/frame-%03u.ppm", dir, frames++);
+        if (!St7735_write_ppm(path)) perror(path);
+    }
+}
+
+void HAL_telemetry_init(void){
+    const char *path = getenv("CONNECT4_TELEMETRY");
+    if (telemetry || !path || !*path) return;
+    telemetry = fopen(path, "wb");
+    if (!telemetry) perror(path);
+}
+
+void HAL_telemetry_write(const uint8_t *data, uint16_t length){
+    if (!telemetry) return;
+    fwrite(data, 1, length, telemetry);
+    fflush(telemetry);
+}
@@ -0,0 +1,99 @@
+/*
+ * lazysmp.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "host/include/lazysmp.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/types.h"
+#include "pthread.h"
+#include "string.h"
+
+// what a helper thread needs: its own copy of the board and of the caller's settings, and where to put its result
+typedef struct {
+    Board_t board;
+    bool maximizing;
+    int max_depth;
+    uint32_t budget_ms;
+    uint8_t first_depth;
+    TTTable_t *table;
+    Algorithm_t algorithm;
+    bool threats;
+    Score_t weights[NUM_EVAL_WEIGHTS];
+    const volatile bool *stop;
+
+    Result_t result;
+    uint8_t depth;
+    uint32_t nodes;
+} Helper_t;
+
+static void *helper_main(void *arg){
+    Helper_t *h = arg;
+
+    // the search state of a new thread is empty, share the caller's table and settings
+    TT_select(h->table);
+    search_algorithm = h->algorithm;
+    eval_threats = h->threats;
+    memcpy(eval_weights, h->weights, sizeof(h->weights));
+    search_stop = h->stop;
+    search_first_depth = h->first_depth;
+
+    h->result = iterative_deepening(&h->board, h->maximizing, h->max_depth, h->budget_ms);
+    h->depth = search_depth;
+    h->nodes = search_nodes;
+    return NULL;
+}
+
+void SMP_search(Board_t *b, bool maximizing, int max_depth, uint32_t budget_ms, int threads, SMPResult_t *out){
+    Helper_t helpers[SMP_MAX_THREADS];
+    pthread_t ids[SMP_MAX_THREADS];
+    volatile bool stop = false;
+    int i, started = 0;
+
+    if (threads > SMP_MAX_THREADS) threads = SMP_MAX_THREADS;
+
+    // the new generation of the table is started here, before the helpers use it, instead of by every
+    // iterative_deepening(): the calling thread takes part in the search like the helpers, from depth 1
+    const volatile bool *caller_stop = search_stop;
+    uint8_t caller_first_depth = search_first_depth;
+    TT_new_search();
+    search_stop = &stop;
+    search_first_depth = 1;
+
+    for (i = 1; i < threads; i++) {
+        Helper_t *h = &helpers[i];
+        h->board = *b;
+        h->maximizing = maximizing;
+        h->max_depth = max_depth;
+        h->budget_ms = budget_ms;
+        h->first_depth = (uint8_t)(1 + i % 2);
+        h->table = TT_selected();
+        h->algorithm = search_algorithm;
+        h->threats = eval_threats;
+        memcpy(h->weights, eval_weights, sizeof(h->weights));
+        h->stop = &stop;
+        if (pthread_create(&ids[i], NULL, helper_main, h) != 0) break;
+        started = i;
+    }
+
+    out->result = iterative_deepening(b, maximizing, max_depth, budget_ms);
+    out->depth = search_depth;
+    out->nodes = search_nodes;
+    out->thread = 0;
+
+    stop = true;
+    search_stop = caller_stop;
+    search_first_depth = caller_first_depth;
+    for (i = 1; i <= started; i++) {
+        pthread_join(ids[i], NULL);
+        out->nodes += helpers[i].nodes;
+        if (helpers[i].depth > out->depth) {
+            out->result = helpers[i].result;
+            out->depth = helpers[i].depth;
+            out->thread = i;
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * position.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "host/include/position.h"
+#include "include/board.h"
+#include "include/bitboard.h"
+#include "include/connect4algorithm.h"
+#include "string.h"
+
+int Position_load_board(Board_t *board, const char *moves){
+    int n = (int)strlen(moves);
+    // the computer has to be the side to move once the string has been played
+    bool is_computer = (n % 2) == 0;
+    int i;
+
+    Board_init(board);
+    for (i = 0; i < n; i++) {
+        int col = moves[i] - '1';
+        if (col < 0 || col >= NUM_COLS) return -1;
+        if (board->height[col] >= NUM_ROWS) return -1;
+
+        Score_t delta = delta_score(board, col, board->height[col], is_computer);
+        if (delta == SCORE_MAX || delta == SCORE_MIN) return -1;
+        Board_make_move(board, col, is_computer, delta);
+        is_computer = !is_computer;
+    }
+    return n;
+}
+
+int Position_load_bitboard(BitBoard_t *b, const char *moves){
+    int n = (int)strlen(moves);
+    int i;
+
+    BitBoard_init(b);
+    for (i = 0; i < n; i++) {
+        int col = moves[i] - '1';
+        if (col < 0 || col >= NUM_COLS) return -1;
+        if (!BitBoard_can_play(b, col)) return -1;
+        if (BitBoard_is_winning_move(b, col)) return -1;
+        BitBoard_play(b, col);
+    }
+    return n;
+}
+
+uint32_t Position_rng_next(uint32_t *state){
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+bool Position_random(char *moves, int ply, bool quiet, uint32_t *state){
+    BitBoard_t b;
+    int i;
+
+    BitBoard_init(&b);
+    for (i = 0; i < ply; i++) {
+        Col_t candidates[NUM_COLS];
+        int n = 0;
+        Col_t c;
+        for (c = 0; c < NUM_COLS; c++) {
+            if (BitBoard_can_play(&b, c) && !BitBoard_is_winning_move(&b, c)) candidates[n++] = c;
+        }
+        if (n == 0) return false;
+        c = candidates[Position_rng_next(state) % n];
+        BitBoard_play(&b, c);
+        moves[i] = (char)('1' + c);
+    }
+    moves[ply] = '\0';
+    if (!quiet) return true;
+
+    // the side to move must have neither a win nor a forced block
+    uint64_t playable = BitBoard_playable(&b);
+    if (BitBoard_winning_cells(b.position, b.mask) & playable) return false;
+    if (BitBoard_winning_cells(b.position ^ b.mask, b.mask) & playable) return false;
+    return true;
+}
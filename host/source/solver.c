@@ -0,0 +1,253 @@
+/*
+ * solver.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "host/include/solver.h"
+#include "include/bitboard.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+
+#define NUM_CELLS (NUM_COLS * NUM_ROWS)
+
+/* transposition table of the solver
+ * the keys are the 49-bit BitBoard_key() of the positions. the table has a prime number of slots, so the index
+ * (key modulo the size) and the low 32 bits of the key stored in the slot identify the key completely
+ * values are 0 for an empty slot, otherwise:
+ *  1 .. MAX - MIN + 1:            upper bound val + MIN - 1
+ *  MAX - MIN + 2 .. 2(MAX - MIN) + 2: lower bound val + 2 MIN - MAX - 2
+ */
+#ifndef SOLVER_TT_SIZE
+#define SOLVER_TT_SIZE 8388593u
+#endif
+
+static uint32_t solver_keys[SOLVER_TT_SIZE];
+static uint8_t solver_values[SOLVER_TT_SIZE];
+
+// static column order, center first
+static const Col_t COLUMN_ORDER[NUM_COLS] = {3, 2, 4, 1, 5, 0, 6};
+
+static uint64_t solver_nodes;
+
+void Solver_reset(void){
+    memset(solver_keys, 0, sizeof(solver_keys));
+    memset(solver_values, 0, sizeof(solver_values));
+}
+
+static void tt_put(uint64_t key, uint8_t value){
+    uint32_t i = (uint32_t)(key % SOLVER_TT_SIZE);
+    solver_keys[i] = (uint32_t)key;
+    solver_values[i] = value;
+}
+
+static uint8_t tt_get(uint64_t key){
+    uint32_t i = (uint32_t)(key % SOLVER_TT_SIZE);
+    return (solver_keys[i] == (uint32_t)key) ? solver_values[i] : 0;
+}
+
+// cells where the player who just moved would win
+static inline uint64_t opponent_winning_cells(const BitBoard_t *b){
+    return BitBoard_winning_cells(b->position ^ b->mask, b->mask);
+}
+
+// playable cells that do not hand the opponent an immediate win.
+// if the opponent threatens to win on a playable cell it has to be blocked; with two such threats the game is lost,
+// and a cell right below an opponent's winning cell must never be played
+static uint64_t non_losing_moves(const BitBoard_t *b){
+    uint64_t possible = BitBoard_playable(b);
+    uint64_t opponent_win = opponent_winning_cells(b);
+    uint64_t forced = possible & opponent_win;
+
+    if (forced) {
+        if (forced & (forced - 1)) return 0;
+        possible = forced;
+    }
+    return possible & ~(opponent_win >> 1);
+}
+
+static bool can_win_next(const BitBoard_t *b){
+    return (BitBoard_winning_cells(b->position, b->mask) & BitBoard_playable(b)) != 0;
+}
+
+// ordering score of a move: how many winning cells the player has after it
+static uint8_t move_score(const BitBoard_t *b, uint64_t cell){
+    return BitBoard_count(BitBoard_winning_cells(b->position | cell, b->mask));
+}
+
+static int negamax(const BitBoard_t *b, int alpha, int beta){
+    uint64_t next = non_losing_moves(b);
+    solver_nodes++;
+
+    // every move lets the opponent win
+    if (next == 0) return -(NUM_CELLS - b->moves) / 2;
+
+    // the board fills up before either side can connect 4
+    if (b->moves >= NUM_CELLS - 2) return 0;
+
+    // the opponent cannot win with their next piece, so the score is bounded by what remains of the game
+    int min = -(NUM_CELLS - 2 - b->moves) / 2;
+    if (alpha < min) {
+        alpha = min;
+        if (alpha >= beta) return alpha;
+    }
+    int max = (NUM_CELLS - 1 - b->moves) / 2;
+    if (beta > max) {
+        beta = max;
+        if (alpha >= beta) return beta;
+    }
+
+    uint64_t key = BitBoard_key(b);
+    uint8_t val = tt_get(key);
+    if (val) {
+        if (val > SOLVER_MAX_SCORE - SOLVER_MIN_SCORE + 1) {
+            min = val + 2 * SOLVER_MIN_SCORE - SOLVER_MAX_SCORE - 2;
+            if (alpha < min) {
+                alpha = min;
+                if (alpha >= beta) return alpha;
+            }
+        } else {
+            max = val + SOLVER_MIN_SCORE - 1;
+            if (beta > max) {
+                beta = max;
+                if (alpha >= beta) return beta;
+            }
+        }
+    }
+
+    // sort the moves by score, center first among equal scores (stable insertion sort)
+    uint64_t moves[NUM_COLS];
+    uint8_t scores[NUM_COLS];
+    int num_moves = 0;
+    int i, j;
+    for (i = 0; i < NUM_COLS; i++) {
+        uint64_t cell = next & BB_COLUMN_MASK(COLUMN_ORDER[i]);
+        if (!cell) continue;
+        uint8_t score = move_score(b, cell);
+        for (j = num_moves; j > 0 && scores[j - 1] < score; j--) {
+            moves[j] = moves[j - 1];
+            scores[j] = scores[j - 1];
+        }
+        moves[j] = cell;
+        scores[j] = score;
+        num_moves++;
+    }
+
+    for (i = 0; i < num_moves; i++) {
+        BitBoard_t child = *b;
+        BitBoard_play_cell(&child, moves[i]);
+        int score = -negamax(&child, -beta, -alpha);
+        if (score >= beta) {
+            tt_put(key, (uint8_t)(score + SOLVER_MAX_SCORE - 2 * SOLVER_MIN_SCORE + 2));
+            return score;
+        }
+        if (score > alpha) alpha = score;
+    }
+
+    tt_put(key, (uint8_t)(alpha - SOLVER_MIN_SCORE + 1));
+    return alpha;
+}
+
+// score of a position: null-window searches that halve the interval the score can be in.
+// a weak solve only keeps the sign of the score, the search can return any value beyond the (-1, 1) window
+static int solve_score(const BitBoard_t *b, bool weak){
+    if (can_win_next(b)) return weak ? 1 : (NUM_CELLS + 1 - b->moves) / 2;
+
+    int min = -(NUM_CELLS - b->moves) / 2;
+    int max = (NUM_CELLS + 1 - b->moves) / 2;
+    if (weak) {
+        min = -1;
+        max = 1;
+    }
+
+    while (min < max) {
+        int med = min + (max - min) / 2;
+        // probe closer to 0 first, positions near a draw are the most common
+        if (med <= 0 && min / 2 < med) med = min / 2;
+        else if (med >= 0 && max / 2 > med) med = max / 2;
+
+        int r = negamax(b, med, med + 1);
+        if (r <= med) max = r;
+        else min = r;
+    }
+    if (weak) return (min > 0) - (min < 0);
+    return min;
+}
+
+// number of moves until the end of the game, winning move included, for a strong score
+static uint8_t plies_to_end(int score, uint8_t moves){
+    if (score == 0) return (uint8_t)(NUM_CELLS - moves);
+
+    // the winner connects 4 with the move played when m pieces are on the board, (NUM_CELLS + 1 - m) / 2 = |score|,
+    // and m has the parity of the winner's moves
+    int m = NUM_CELLS + 1 - 2 * (score > 0 ? score : -score);
+    bool winner_to_move = score > 0;
+    if ((m % 2 == moves % 2) != winner_to_move) m--;
+    return (uint8_t)(m - moves + 1);
+}
+
+void Solver_solve(const BitBoard_t *b, bool weak, SolverResult_t *out){
+    solver_nodes = 0;
+    int score = solve_score(b, weak);
+
+    out->score = (int8_t)score;
+    out->result = (score > 0) - (score < 0);
+    out->plies = weak ? 0 : plies_to_end(score, b->moves);
+    out->nodes = solver_nodes;
+}
+
+Col_t Solver_best_move(const BitBoard_t *b, bool weak, SolverResult_t *out){
+    Col_t best = 0;
+    int i;
+
+    Solver_solve(b, weak, out);
+    int target = out->score;
+
+    for (i = 0; i < NUM_COLS; i++) {
+        Col_t c = COLUMN_ORDER[i];
+        if (!BitBoard_can_play(b, c)) continue;
+        best = c;
+        if (BitBoard_is_winning_move(b, c)) break;
+
+        BitBoard_t child;
+        int score;
+        child = *b;
+        BitBoard_play(&child, c);
+
+        // the move keeps the score if the opponent's score after it is at most -target
+        if (can_win_next(&child)) score = weak ? 1 : (NUM_CELLS + 1 - child.moves) / 2;
+        else score = negamax(&child, -target, -target + 1);
+        if (score <= -target) break;
+    }
+
+    out->nodes = solver_nodes;
+    return best;
+}
+
+uint64_t Solver_analyze(const BitBoard_t *b, bool weak, int8_t scores[NUM_COLS]){
+    Col_t c;
+    solver_nodes = 0;
+    for (c = 0; c < NUM_COLS; c++) {
+        if (!BitBoard_can_play(b, c)) {
+            scores[c] = SOLVER_INVALID_SCORE;
+        }
+        else if (BitBoard_is_winning_move(b, c)) {
+            scores[c] = weak ? 1 : (int8_t)((NUM_CELLS + 1 - b->moves) / 2);
+        }
+        else {
+            BitBoard_t child = *b;
+            BitBoard_play(&child, c);
+            scores[c] = (int8_t)-solve_score(&child, weak);
+        }
+    }
+    return solver_nodes;
+}
+
+void Solver_solve_board(const Board_t *board, bool computer_to_move, bool weak, SolverResult_t *out){
+    BitBoard_t b;
+    BitBoard_from_board(&b, board, computer_to_move);
+    Solver_solve(&b, weak, out);
+}
@@ -0,0 +1,139 @@
+/*
+ * st7735_host.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "host/include/st7735_host.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "stdio.h"
+#include "string.h"
+
+// commands of the controller, like in LcdDriver/Crystalfontz128x128_ST7735.h
+#define CM_CASET    0x2A
+#define CM_RASET    0x2B
+#define CM_RAMWR    0x2C
+#define CM_MADCTL   0x36
+
+#define MADCTL_MY   0x80
+#define MADCTL_MX   0x40
+#define MADCTL_MV   0x20
+
+// memory of the controller, 132x132 on the 128x128 panel, and the corner of the part the panel shows
+#define GRAM_SIZE   132
+#define SCREEN_COL  2
+#define SCREEN_ROW  1
+
+static uint16_t gram[GRAM_SIZE][GRAM_SIZE];
+static uint8_t madctl;
+
+// address window and the address the next pixel goes to, before MADCTL is applied
+static uint16_t x_start, x_end = GRAM_SIZE - 1, y_start, y_end = GRAM_SIZE - 1;
+static uint16_t x, y;
+
+// command being received, index of its next parameter, and the high byte of a pixel waiting for its low byte
+static uint8_t command;
+static uint16_t parameter;
+static uint8_t high;
+
+static St7735Traffic_t traffic;
+
+void St7735_reset(void){
+    memset(gram, 0, sizeof(gram));
+    madctl = 0;
+    x_start = y_start = 0;
+    x_end = y_end = GRAM_SIZE - 1;
+    x = y = 0;
+    command = 0;
+    parameter = 0;
+}
+
+void St7735_command(uint8_t new_command){
+    traffic.commands++;
+    command = new_command;
+    parameter = 0;
+    if (command == CM_CASET || command == CM_RASET) traffic.windows++;
+    if (command == CM_RAMWR) {
+        x = x_start;
+        y = y_start;
+    }
+}
+
+// writes a pixel at the current address and moves to the next one, wrapping inside the window
+static void write_pixel(uint16_t color){
+    uint16_t col = x, row = y;
+
+    if (madctl & MADCTL_MV) {
+        col = y;
+        row = x;
+    }
+    if (madctl & MADCTL_MX) col = GRAM_SIZE - 1 - col;
+    if (madctl & MADCTL_MY) row = GRAM_SIZE - 1 - row;
+    if (col < GRAM_SIZE && row < GRAM_SIZE) gram[row][col] = color;
+    traffic.pixels++;
+
+    if (x++ >= x_end) {
+        x = x_start;
+        if (y++ >= y_end) y = y_start;
+    }
+}
+
+void St7735_data(uint8_t data){
+    traffic.data_bytes++;
+    switch (command) {
+        case CM_CASET:
+        case CM_RASET:
+        {
+            uint16_t *start = command == CM_CASET ? &x_start : &y_start;
+            uint16_t *end = command == CM_CASET ? &x_end : &y_end;
+            // the parameters are the start and the end of the range, high byte first
+            switch (parameter) {
+                case 0: *start = (uint16_t)(data << 8); break;
+                case 1: *start |= data; break;
+                case 2: *end = (uint16_t)(data << 8); break;
+                case 3: *end |= data; break;
+            }
+            break;
+        }
+        case CM_MADCTL:
+            if (parameter == 0) madctl = data;
+            break;
+        case CM_RAMWR:
+            if (parameter & 1) write_pixel((uint16_t)((high << 8) | data));
+            else high = data;
+            break;
+    }
+    parameter++;
+}
+
+uint16_t St7735_pixel(uint8_t screen_x, uint8_t screen_y){
+    // upright the panel shows the memory rotated by half a turn, which LCD_ORIENTATION_UP undoes with MX and MY
+    return gram[SCREEN_ROW + ST7735_HEIGHT - 1 - screen_y][SCREEN_COL + ST7735_WIDTH - 1 - screen_x];
+}
+
+St7735Traffic_t St7735_traffic(void){
+    return traffic;
+}
+
+bool St7735_write_ppm(const char *path){
+    FILE *f = fopen(path, "wb");
+    uint8_t line[ST7735_WIDTH * 3];
+    int i, j;
+
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", ST7735_WIDTH, ST7735_HEIGHT);
+    for (j = 0; j < ST7735_HEIGHT; j++) {
+        for (i = 0; i < ST7735_WIDTH; i++) {
+            uint16_t color = St7735_pixel((uint8_t)i, (uint8_t)j);
+            // 5-6-5 to 8 bits per channel, the high bits are repeated in the low ones so that white stays 255
+            uint8_t r = (uint8_t)((color >> 11) & 0x1F), g = (uint8_t)((color >> 5) & 0x3F), b = (uint8_t)(color & 0x1F);
+            line[3 * i] = (uint8_t)((r << 3) | (r >> 2));
+            line[3 * i + 1] = (uint8_t)((g << 2) | (g >> 4));
+            line[3 * i + 2] = (uint8_t)((b << 3) | (b >> 2));
+        }
+        fwrite(line, 1, sizeof(line), f);
+    }
+    return fclose(f) == 0;
+}
@@ -0,0 +1,346 @@
+/*
+ * analyze.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that analyzes a stream of positions with a pool of threads and prints one JSON line per position
+ *
+ * the positions are move strings, one per line, read from a file or stdin as they come; empty lines and lines starting
+ * with # are skipped. each position is searched by iterative_deepening() for the side to move, and the results are
+ * printed on stdout in the order of the input, as soon as every earlier position is done:
+ *     {"line":3,"moves":"4453","move":4,"score":-12,"depth":12,"nodes":52843,"time_us":8412}
+ * move is the best column (1 to 7), score is from the side to move's point of view (32767 and -32767 are forced wins
+ * and losses), depth is the last completed iteration. positions that can not be searched give an error instead:
+ *     {"line":4,"moves":"4x","error":"invalid position"}
+ *
+ * the main thread reads the input into a window of ANALYZE_WINDOW slots and deals the positions round robin to the
+ * deques of the workers. a worker takes the oldest position of its own deque; when it is empty it steals the newest
+ * one of another worker's deque, so a worker stuck on a long search does not hold up the others. a writer thread
+ * prints the slots in order and gives them back to the reader, so the memory does not grow with the input.
+ * every worker allocates its transposition table once and reuses its board and search state (per thread, see
+ * THREAD_LOCAL) for all its positions: nothing is allocated per position. the tables are cleared before every
+ * position, so the results do not depend on which worker searched what
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o analyze host/tools/analyze.c $ENGINE -lpthread
+ * usage:
+ *     ./analyze [-d depth] [-b budget ms] [-t threads] [-a minimax|pvs|mtdf] [file] > results.jsonl
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "pthread.h"
+#include "unistd.h"
+
+#define DEFAULT_DEPTH 12
+#define MAX_THREADS 256
+
+// positions read ahead of the output, must be a power of 2
+#define ANALYZE_WINDOW 4096
+
+// longest input line kept, longer lines are reported as invalid
+#define MAX_LINE 64
+
+static const char *ALGORITHM_NAMES[] = {"minimax", "pvs", "mtdf"};
+#define NUM_ALGORITHMS 3
+
+typedef enum {
+    SLOT_FREE,
+    SLOT_QUEUED,
+    SLOT_DONE
+} SlotState_t;
+
+// a position of the window, from the input to the output
+typedef struct {
+    SlotState_t state;
+    unsigned long line;
+    char moves[MAX_LINE + 1];
+    const char *error;
+    Result_t result;
+    uint8_t depth;
+    uint32_t nodes;
+    double seconds;
+} Slot_t;
+
+// deque of positions dealt to a worker, as sequence numbers: head is the oldest, tail - 1 the newest
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t head, tail;
+    uint32_t jobs[ANALYZE_WINDOW];
+} Deque_t;
+
+static Slot_t slots[ANALYZE_WINDOW];
+static Deque_t deques[MAX_THREADS];
+static int num_workers;
+
+// search settings
+static int max_depth = DEFAULT_DEPTH;
+static uint32_t budget_ms = UINT32_MAX;
+static Algorithm_t algorithm = SEARCH_ALGORITHM;
+
+// slots: a worker marks a slot done, the writer prints it and frees it for the reader
+static pthread_mutex_t slot_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t slot_done = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t slot_free = PTHREAD_COND_INITIALIZER;
+
+// idle workers wait for work to be dealt or for the end of the input
+static pthread_mutex_t work_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_ready = PTHREAD_COND_INITIALIZER;
+static uint32_t pending;            // dealt and not taken yet, written under work_lock or atomically
+static bool end_of_input;
+static uint32_t num_positions;      // valid once end_of_input is set
+
+static void deque_push(Deque_t *d, uint32_t job){
+    pthread_mutex_lock(&d->lock);
+    d->jobs[d->tail++ & (ANALYZE_WINDOW - 1)] = job;
+    pthread_mutex_unlock(&d->lock);
+}
+
+// takes the oldest job if own, the newest one if stolen
+static bool deque_take(Deque_t *d, bool own, uint32_t *job){
+    bool found = false;
+    pthread_mutex_lock(&d->lock);
+    if (d->head != d->tail) {
+        *job = own ? d->jobs[d->head++ & (ANALYZE_WINDOW - 1)] : d->jobs[--d->tail & (ANALYZE_WINDOW - 1)];
+        found = true;
+    }
+    pthread_mutex_unlock(&d->lock);
+    if (found) __atomic_fetch_sub(&pending, 1, __ATOMIC_RELAXED);
+    return found;
+}
+
+static bool next_job(int worker, uint32_t *job){
+    int i;
+    for (;;) {
+        if (deque_take(&deques[worker], true, job)) return true;
+        for (i = 1; i < num_workers; i++) {
+            if (deque_take(&deques[(worker + i) % num_workers], false, job)) return true;
+        }
+
+        pthread_mutex_lock(&work_lock);
+        while (__atomic_load_n(&pending, __ATOMIC_RELAXED) == 0 && !end_of_input)
+            pthread_cond_wait(&work_ready, &work_lock);
+        bool finished = __atomic_load_n(&pending, __ATOMIC_RELAXED) == 0 && end_of_input;
+        pthread_mutex_unlock(&work_lock);
+        if (finished) return false;
+    }
+}
+
+static void analyze(Slot_t *slot, Board_t *board){
+    slot->error = NULL;
+    if (strlen(slot->moves) > NUM_COLS * NUM_ROWS || Position_load_board(board, slot->moves) < 0) {
+        slot->error = "invalid position";
+        return;
+    }
+    if (Board_full(board)) {
+        slot->error = "board full";
+        return;
+    }
+
+    TT_clear();
+    MoveOrder_clear();
+    Ticks_t start = Timer_now();
+    Result_t r = iterative_deepening(board, true, max_depth, budget_ms);
+    slot->seconds = Timer_ticks_to_us(Timer_now() - start) * 1e-6;
+
+    // the board is loaded with the side to move as the computer, whose scores are the ones of the side to move
+    slot->result = r;
+    if (slot->result.score == SCORE_MIN) slot->result.score = -SCORE_MAX;
+    slot->depth = search_depth;
+    slot->nodes = search_nodes;
+}
+
+static void *worker_main(void *arg){
+    int worker = (int)(intptr_t)arg;
+    TTTable_t *table = TT_create();
+    Board_t board;
+    uint32_t job;
+
+    if (!table) {
+        fprintf(stderr, "not enough memory for the transposition tables\n");
+        exit(1);
+    }
+    TT_select(table);
+    search_algorithm = algorithm;
+
+    while (next_job(worker, &job)) {
+        Slot_t *slot = &slots[job & (ANALYZE_WINDOW - 1)];
+        analyze(slot, &board);
+
+        pthread_mutex_lock(&slot_lock);
+        slot->state = SLOT_DONE;
+        pthread_cond_signal(&slot_done);
+        pthread_mutex_unlock(&slot_lock);
+    }
+
+    TT_destroy(table);
+    return NULL;
+}
+
+// prints a string as a JSON string
+static void print_json_string(const char *s){
+    putchar('"');
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') printf("\\%c", *s);
+        else if ((unsigned char)*s < 0x20) printf("\\u%04x", (unsigned char)*s);
+        else putchar(*s);
+    }
+    putchar('"');
+}
+
+static void *writer_main(void *arg){
+    uint32_t next;
+    (void)arg;
+
+    for (next = 0;; next++) {
+        Slot_t *slot = &slots[next & (ANALYZE_WINDOW - 1)];
+
+        pthread_mutex_lock(&slot_lock);
+        while (!(end_of_input && next >= num_positions) && slot->state != SLOT_DONE) {
+            // flush what is already printed before waiting, so the output streams
+            pthread_mutex_unlock(&slot_lock);
+            fflush(stdout);
+            pthread_mutex_lock(&slot_lock);
+            if (!(end_of_input && next >= num_positions) && slot->state != SLOT_DONE)
+                pthread_cond_wait(&slot_done, &slot_lock);
+        }
+        bool finished = end_of_input && next >= num_positions;
+        pthread_mutex_unlock(&slot_lock);
+        if (finished) break;
+
+        printf("{\"line\":%lu,\"moves\":", slot->line);
+        print_json_string(slot->moves);
+        if (slot->error) {
+            printf(",\"error\":\"%s\"}\n", slot->error);
+        }
+        else {
+            printf(",\"move\":%d,\"score\":%d,\"depth\":%d,\"nodes\":%lu,\"time_us\":%.0f}\n", slot->result.move + 1,
+                   slot->result.score, slot->depth, (unsigned long)slot->nodes, slot->seconds * 1e6);
+        }
+
+        pthread_mutex_lock(&slot_lock);
+        slot->state = SLOT_FREE;
+        pthread_cond_signal(&slot_free);
+        pthread_mutex_unlock(&slot_lock);
+    }
+    fflush(stdout);
+    return NULL;
+}
+
+int main(int argc, char **argv){
+    pthread_t workers[MAX_THREADS], writer;
+    FILE *input = stdin;
+    char line[MAX_LINE + 2];
+    unsigned long line_number = 0;
+    uint32_t seq = 0;
+    bool skipping = false;
+    int i;
+
+    num_workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            max_depth = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            budget_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+            if (budget_ms == 0) budget_ms = UINT32_MAX;
+        }
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            num_workers = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            int a;
+            i++;
+            for (a = 0; a < NUM_ALGORITHMS && strcmp(argv[i], ALGORITHM_NAMES[a]) != 0; a++);
+            if (a == NUM_ALGORITHMS) {
+                fprintf(stderr, "unknown algorithm \"%s\"\n", argv[i]);
+                return 1;
+            }
+            algorithm = (Algorithm_t)a;
+        }
+        else if (input == stdin && argv[i][0] != '-') {
+            input = fopen(argv[i], "r");
+            if (!input) {
+                fprintf(stderr, "can not open %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else {
+            fprintf(stderr, "usage: %s [-d depth] [-b budget ms] [-t threads] [-a minimax|pvs|mtdf] [file]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+    if (max_depth < 1) max_depth = 1;
+    if (num_workers < 1) num_workers = 1;
+    if (num_workers > MAX_THREADS) num_workers = MAX_THREADS;
+
+    Timer_init();
+    for (i = 0; i < num_workers; i++) {
+        pthread_mutex_init(&deques[i].lock, NULL);
+        pthread_create(&workers[i], NULL, worker_main, (void *)(intptr_t)i);
+    }
+    pthread_create(&writer, NULL, writer_main, NULL);
+
+    while (fgets(line, sizeof(line), input)) {
+        size_t length = strlen(line);
+        bool complete = length > 0 && line[length - 1] == '\n';
+
+        // the rest of a line that was too long
+        if (skipping) {
+            skipping = !complete;
+            continue;
+        }
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!complete && !feof(input)) skipping = true;
+        char *moves = line + strspn(line, " \t");
+        moves[strcspn(moves, " \t")] = '\0';
+        if (moves[0] == '\0' || moves[0] == '#') continue;
+        if (strlen(moves) > MAX_LINE) {
+            // too long to be a position: keep the beginning, it is reported as invalid
+            moves[MAX_LINE] = '\0';
+            moves[MAX_LINE - 1] = '?';
+        }
+
+        // wait for the slot to be printed by the writer
+        Slot_t *slot = &slots[seq & (ANALYZE_WINDOW - 1)];
+        pthread_mutex_lock(&slot_lock);
+        while (slot->state != SLOT_FREE) pthread_cond_wait(&slot_free, &slot_lock);
+        slot->state = SLOT_QUEUED;
+        pthread_mutex_unlock(&slot_lock);
+
+        slot->line = line_number;
+        strcpy(slot->moves, moves);
+        deque_push(&deques[seq % num_workers], seq);
+        seq++;
+
+        pthread_mutex_lock(&work_lock);
+        __atomic_fetch_add(&pending, 1, __ATOMIC_RELAXED);
+        pthread_cond_signal(&work_ready);
+        pthread_mutex_unlock(&work_lock);
+    }
+
+    pthread_mutex_lock(&work_lock);
+    pthread_mutex_lock(&slot_lock);
+    num_positions = seq;
+    end_of_input = true;
+    pthread_cond_signal(&slot_done);
+    pthread_mutex_unlock(&slot_lock);
+    pthread_cond_broadcast(&work_ready);
+    pthread_mutex_unlock(&work_lock);
+
+    for (i = 0; i < num_workers; i++) pthread_join(workers[i], NULL);
+    pthread_join(writer, NULL);
+    if (input != stdin) fclose(input);
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * bench_board.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host benchmark that compares the array board (Board_t) with the packed bitboard (BitBoard_t)
+ *
+ * both layouts walk the same game tree: every legal move is expanded down to a fixed depth, and a move that wins
+ * is counted as a leaf instead of being expanded, which is how minimax() treats it. the array walk detects wins
+ * and keeps the incremental score with delta_score(), the bitboard walk with BitBoard_is_winning_move().
+ * the node counts of the two walks must match, the output compares how many nodes per second each one visits.
+ *
+ * build from the repository root:
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o bench_board host/tools/bench_board.c $ENGINE
+ * with ENGINE set to the engine sources listed in README.md
+ * usage:
+ *     ./bench_board [depth]
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/bitboard.h"
+#include "include/connect4algorithm.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "stdio.h"
+#include "stdlib.h"
+
+// positions the benchmark walks from, as move strings
+static const char *BENCH_POSITIONS[] = {
+    "",
+    "4444",
+    "43443555",
+    "4453563322",
+    "4436452151762",
+    "41414155226",
+};
+#define NUM_BENCH_POSITIONS (sizeof(BENCH_POSITIONS) / sizeof(BENCH_POSITIONS[0]))
+
+#define DEFAULT_DEPTH 7
+
+static uint64_t walk_array(Board_t *b, int depth, bool is_computer){
+    uint64_t nodes = 1;
+    Col_t c;
+
+    if (depth == 0) return nodes;
+    for (c = 0; c < NUM_COLS; c++) {
+        if (b->height[c] >= NUM_ROWS) continue;
+        Score_t delta = delta_score(b, c, b->height[c], is_computer);
+        if (delta == SCORE_MAX || delta == SCORE_MIN) {
+            nodes++;
+            continue;
+        }
+        Board_make_move(b, c, is_computer, delta);
+        nodes += walk_array(b, depth - 1, !is_computer);
+        Board_unmake_move(b, c, is_computer, delta);
+    }
+    return nodes;
+}
+
+static uint64_t walk_bitboard(BitBoard_t *b, int depth){
+    uint64_t nodes = 1;
+    Col_t c;
+
+    if (depth == 0) return nodes;
+    for (c = 0; c < NUM_COLS; c++) {
+        if (!BitBoard_can_play(b, c)) continue;
+        if (BitBoard_is_winning_move(b, c)) {
+            nodes++;
+            continue;
+        }
+        BitBoard_play(b, c);
+        nodes += walk_bitboard(b, depth - 1);
+        BitBoard_undo(b, c);
+    }
+    return nodes;
+}
+
+int main(int argc, char **argv){
+    int depth = (argc > 1) ? atoi(argv[1]) : DEFAULT_DEPTH;
+    uint64_t total_array = 0, total_bitboard = 0;
+    double time_array = 0, time_bitboard = 0;
+    unsigned i;
+
+    Timer_init();
+    printf("%-14s %12s %10s %10s %10s\n", "position", "nodes", "array Mn/s", "bb Mn/s", "speedup");
+    for (i = 0; i < NUM_BENCH_POSITIONS; i++) {
+        Board_t board;
+        BitBoard_t bb;
+        if (Position_load_board(&board, BENCH_POSITIONS[i]) < 0 ||
+            Position_load_bitboard(&bb, BENCH_POSITIONS[i]) < 0) {
+            fprintf(stderr, "invalid bench position \"%s\"\n", BENCH_POSITIONS[i]);
+            return 1;
+        }
+
+        Ticks_t t0 = Timer_now();
+        uint64_t n_array = walk_array(&board, depth, true);
+        Ticks_t t1 = Timer_now();
+        uint64_t n_bitboard = walk_bitboard(&bb, depth);
+        Ticks_t t2 = Timer_now();
+        double seconds_array = Timer_ticks_to_us(t1 - t0) * 1e-6;
+        double seconds_bitboard = Timer_ticks_to_us(t2 - t1) * 1e-6;
+
+        if (n_array != n_bitboard) {
+            fprintf(stderr, "node count mismatch on \"%s\": array %llu, bitboard %llu\n", BENCH_POSITIONS[i],
+                    (unsigned long long)n_array, (unsigned long long)n_bitboard);
+            return 1;
+        }
+
+        printf("%-14s %12llu %10.2f %10.2f %9.2fx\n", BENCH_POSITIONS[i][0] ? BENCH_POSITIONS[i] : "(empty)",
+               (unsigned long long)n_array, n_array / seconds_array / 1e6, n_bitboard / seconds_bitboard / 1e6,
+               seconds_array / seconds_bitboard);
+
+        total_array += n_array;
+        total_bitboard += n_bitboard;
+        time_array += seconds_array;
+        time_bitboard += seconds_bitboard;
+    }
+    printf("%-14s %12llu %10.2f %10.2f %9.2fx\n", "total", (unsigned long long)total_array,
+           total_array / time_array / 1e6, total_bitboard / time_bitboard / 1e6, time_array / time_bitboard);
+    return 0;
+}
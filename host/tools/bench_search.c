@@ -0,0 +1,173 @@
+/*
+ * bench_search.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host benchmark of the search engine on a corpus of positions bucketed by game phase
+ *
+ * the corpus is generated from a fixed seed, so the same positions are searched by every build and the results can be
+ * compared across engine changes: every position is reached by random moves that never end the game, and positions
+ * where the side to move can win or has to block on the next move are discarded since the search solves them at once.
+ * each position is searched with iterative_deepening() up to each depth, with no time limit and empty transposition
+ * and move ordering tables, and one CSV line is printed per search on stdout. totals per phase are printed on stderr
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o bench_search host/tools/bench_search.c $ENGINE
+ * usage:
+ *     ./bench_search [-a minimax|pvs|mtdf] [-n positions per phase] [-s seed] [-p] [depth ...] > results.csv
+ * -p only prints the corpus, one "phase,moves" line per position
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/bitboard.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define DEFAULT_POSITIONS 10
+#define DEFAULT_SEED 0xC4C4C4C4u
+#define MAX_POSITIONS 1000
+
+static const int DEFAULT_DEPTHS[] = {4, 6, 8};
+#define MAX_DEPTHS 16
+
+static const char *ALGORITHM_NAMES[] = {"minimax", "pvs", "mtdf"};
+#define NUM_ALGORITHMS 3
+
+// game phases, by number of pieces on the board: [min_moves, max_moves]
+typedef struct {
+    const char *name;
+    uint8_t min_moves;
+    uint8_t max_moves;
+} Phase_t;
+
+static const Phase_t PHASES[] = {
+    {"opening",     4, 11},
+    {"middlegame", 12, 23},
+    {"endgame",    24, 33},
+};
+#define NUM_PHASES (sizeof(PHASES) / sizeof(PHASES[0]))
+
+// the corpus: one move string per position
+static char corpus[NUM_PHASES][MAX_POSITIONS][NUM_COLS * NUM_ROWS + 1];
+
+static uint32_t rng_state;
+
+static void generate_corpus(int per_phase){
+    unsigned p;
+    int i;
+    for (p = 0; p < NUM_PHASES; p++) {
+        for (i = 0; i < per_phase; i++) {
+            int range = PHASES[p].max_moves - PHASES[p].min_moves + 1;
+            int ply;
+            do {
+                ply = PHASES[p].min_moves + (int)(Position_rng_next(&rng_state) % range);
+            } while (!Position_random(corpus[p][i], ply, true, &rng_state));
+        }
+    }
+}
+
+static int parse_algorithm(const char *name){
+    int a;
+    for (a = 0; a < NUM_ALGORITHMS; a++) {
+        if (strcmp(name, ALGORITHM_NAMES[a]) == 0) return a;
+    }
+    return -1;
+}
+
+int main(int argc, char **argv){
+    int depths[MAX_DEPTHS];
+    int num_depths = 0;
+    int per_phase = DEFAULT_POSITIONS;
+    int algorithm = SEARCH_ALGORITHM;
+    bool print_only = false;
+    unsigned p;
+    int i, d;
+
+    rng_state = DEFAULT_SEED;
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+            algorithm = parse_algorithm(argv[++i]);
+            if (algorithm < 0) {
+                fprintf(stderr, "unknown algorithm \"%s\"\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            per_phase = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            rng_state = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-p") == 0) {
+            print_only = true;
+        }
+        else if (num_depths < MAX_DEPTHS && atoi(argv[i]) > 0) {
+            depths[num_depths++] = atoi(argv[i]);
+        }
+        else {
+            fprintf(stderr, "usage: %s [-a minimax|pvs|mtdf] [-n positions] [-s seed] [-p] [depth ...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_depths == 0) {
+        num_depths = (int)(sizeof(DEFAULT_DEPTHS) / sizeof(DEFAULT_DEPTHS[0]));
+        memcpy(depths, DEFAULT_DEPTHS, sizeof(DEFAULT_DEPTHS));
+    }
+    if (per_phase < 1 || per_phase > MAX_POSITIONS) {
+        fprintf(stderr, "the number of positions must be between 1 and %d\n", MAX_POSITIONS);
+        return 1;
+    }
+    if (rng_state == 0) rng_state = DEFAULT_SEED;
+
+    generate_corpus(per_phase);
+
+    if (print_only) {
+        for (p = 0; p < NUM_PHASES; p++) {
+            for (i = 0; i < per_phase; i++) printf("%s,%s\n", PHASES[p].name, corpus[p][i]);
+        }
+        return 0;
+    }
+
+    Timer_init();
+    search_algorithm = (Algorithm_t)algorithm;
+
+    printf("phase,position,moves,algorithm,depth,nodes,time_us,nodes_per_s,move,score\n");
+    for (d = 0; d < num_depths; d++) {
+        for (p = 0; p < NUM_PHASES; p++) {
+            unsigned long long total_nodes = 0;
+            double total_time = 0;
+
+            for (i = 0; i < per_phase; i++) {
+                Board_t board;
+                if (Position_load_board(&board, corpus[p][i]) < 0) {
+                    fprintf(stderr, "invalid position \"%s\"\n", corpus[p][i]);
+                    return 1;
+                }
+
+                TT_clear();
+                MoveOrder_clear();
+                Ticks_t start = Timer_now();
+                Result_t r = iterative_deepening(&board, true, depths[d], UINT32_MAX);
+                double elapsed = Timer_ticks_to_us(Timer_now() - start) * 1e-6;
+
+                total_nodes += search_nodes;
+                total_time += elapsed;
+                printf("%s,%s,%d,%s,%d,%lu,%.0f,%.0f,%d,%d\n", PHASES[p].name, corpus[p][i], board.moves,
+                       ALGORITHM_NAMES[algorithm], depths[d], (unsigned long)search_nodes, elapsed * 1e6,
+                       elapsed > 0 ? search_nodes / elapsed : 0.0, r.move + 1, r.score);
+            }
+
+            fprintf(stderr, "depth %2d %-10s %12llu nodes %9.3f s %12.0f nodes/s\n", depths[d], PHASES[p].name,
+                    total_nodes, total_time, total_time > 0 ? total_nodes / total_time : 0.0);
+        }
+    }
+    return 0;
+}
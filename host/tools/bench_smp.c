@@ -0,0 +1,136 @@
+/*
+ * bench_smp.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host benchmark of the parallel search (host/source/lazysmp.c) from 1 to N threads
+ *
+ * the positions are middlegame positions generated from a fixed seed, like the corpus of bench_search. every
+ * position is searched by SMP_search() with each thread count, starting from an empty transposition table and empty
+ * move ordering tables, and one line is printed per thread count:
+ * - by default every search goes to a fixed depth with no time limit, and the line gives the time to reach it and the
+ *   speedup with respect to one thread
+ * - with -b every search gets a time budget and no depth limit, and the line gives the average depth reached
+ * both also give the total nodes of all the threads and how many moves agree with the single-threaded search.
+ * the speedup can only be measured on a machine with at least as many free cores as threads
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o bench_smp host/tools/bench_smp.c host/source/lazysmp.c $ENGINE -lpthread
+ * usage:
+ *     ./bench_smp [-d depth] [-b budget ms] [-n positions] [-s seed] [max threads]
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/bitboard.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "host/include/lazysmp.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "unistd.h"
+
+#define DEFAULT_DEPTH 12
+#define DEFAULT_POSITIONS 20
+#define DEFAULT_SEED 0xC4C4C4C4u
+#define MAX_POSITIONS 1000
+
+// the positions have between MIN_MOVES and MAX_MOVES pieces, the middlegame of bench_search
+#define MIN_MOVES 12
+#define MAX_MOVES 23
+
+static char positions[MAX_POSITIONS][NUM_COLS * NUM_ROWS + 1];
+
+// moves chosen with one thread, the reference of the agreement count
+static Col_t reference[MAX_POSITIONS];
+
+static uint32_t rng_state;
+
+int main(int argc, char **argv){
+    int depth = DEFAULT_DEPTH;
+    uint32_t budget_ms = 0;
+    int num_positions = DEFAULT_POSITIONS;
+    int max_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    double single_time = 0;
+    int threads, i;
+
+    rng_state = DEFAULT_SEED;
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            budget_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            num_positions = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            rng_state = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (atoi(argv[i]) > 0) {
+            max_threads = atoi(argv[i]);
+        }
+        else {
+            fprintf(stderr, "usage: %s [-d depth] [-b budget ms] [-n positions] [-s seed] [max threads]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_positions < 1 || num_positions > MAX_POSITIONS || depth < 1) {
+        fprintf(stderr, "the number of positions must be between 1 and %d\n", MAX_POSITIONS);
+        return 1;
+    }
+    if (max_threads > SMP_MAX_THREADS) max_threads = SMP_MAX_THREADS;
+    if (rng_state == 0) rng_state = DEFAULT_SEED;
+
+    for (i = 0; i < num_positions; i++) {
+        int ply;
+        do {
+            ply = MIN_MOVES + (int)(Position_rng_next(&rng_state) % (MAX_MOVES - MIN_MOVES + 1));
+        } while (!Position_random(positions[i], ply, true, &rng_state));
+    }
+
+    Timer_init();
+    if (budget_ms) printf("%d positions, %lu ms per search\n", num_positions, (unsigned long)budget_ms);
+    else printf("%d positions, depth %d\n", num_positions, depth);
+    printf("threads      time (s)         nodes       nodes/s  %s  same move\n", budget_ms ? "avg depth" : "  speedup");
+
+    // 1, 2, 4, ... threads, and max_threads itself
+    for (threads = 1; threads <= max_threads; threads = (threads * 2 > max_threads && threads < max_threads) ?
+                                                        max_threads : threads * 2) {
+        unsigned long long nodes = 0;
+        unsigned long depths = 0;
+        int same = 0;
+        double elapsed = 0;
+
+        for (i = 0; i < num_positions; i++) {
+            Board_t board;
+            SMPResult_t r;
+            Position_load_board(&board, positions[i]);
+            TT_clear();
+            MoveOrder_clear();
+            // every search is timed on its own, the ticks of the timer wrap after about an hour
+            Ticks_t start = Timer_now();
+            SMP_search(&board, true, budget_ms ? HARD_MAX_DEPTH : depth, budget_ms ? budget_ms : UINT32_MAX,
+                       threads, &r);
+            elapsed += Timer_ticks_to_us(Timer_now() - start) * 1e-6;
+
+            nodes += r.nodes;
+            depths += r.depth;
+            if (threads == 1) reference[i] = r.result.move;
+            if (r.result.move == reference[i]) same++;
+        }
+
+        if (threads == 1) single_time = elapsed;
+        printf("%7d  %12.3f  %12llu  %12.0f  ", threads, elapsed, nodes, elapsed > 0 ? nodes / elapsed : 0.0);
+        if (budget_ms) printf("%9.2f", (double)depths / num_positions);
+        else printf("%9.2f", elapsed > 0 ? single_time / elapsed : 0.0);
+        printf("  %4d/%d\n", same, num_positions);
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * c4solve.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that solves positions exactly with the solver of host/include/solver.h
+ *
+ * positions are move strings (see host/include/position.h), given as arguments or read from stdin one per line.
+ * for every position the tool prints the score and result for the player to move, the number of moves until the end
+ * of the game with perfect play, the nodes explored and the time taken.
+ * with -a every column is solved instead and one score per column is printed ('-' for full columns).
+ * the transposition table is kept between positions, so solving the positions of one game in order is fast
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o c4solve host/tools/c4solve.c host/source/solver.c $ENGINE
+ * usage:
+ *     ./c4solve [-w] [-a] [moves ...]
+ *      -w  weak solve: win / draw / loss only
+ *      -a  analyze: solve every column of the position
+ */
+
+#include "include/types.h"
+#include "include/bitboard.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "host/include/solver.h"
+#include "stdio.h"
+#include "string.h"
+
+static const char *RESULT_NAMES[] = {"loss", "draw", "win"};
+
+static void solve_position(const char *moves, bool weak, bool analyze){
+    BitBoard_t b;
+    Ticks_t start;
+    Col_t c;
+
+    if (Position_load_bitboard(&b, moves) < 0) {
+        printf("%s: invalid position\n", moves);
+        return;
+    }
+
+    start = Timer_now();
+    if (analyze) {
+        int8_t scores[NUM_COLS];
+        uint64_t nodes = Solver_analyze(&b, weak, scores);
+        printf("%s:", moves);
+        for (c = 0; c < NUM_COLS; c++) {
+            if (scores[c] == SOLVER_INVALID_SCORE) printf(" -");
+            else printf(" %d", scores[c]);
+        }
+        printf("  nodes %llu  %u ms\n", (unsigned long long)nodes, (unsigned)Timer_ms_since(start));
+    }
+    else {
+        SolverResult_t r;
+        Solver_solve(&b, weak, &r);
+        printf("%s: score %d  %s", moves, r.score, RESULT_NAMES[r.result + 1]);
+        if (!weak && r.result != 0) printf(" in %u plies", r.plies);
+        printf("  nodes %llu  %u ms\n", (unsigned long long)r.nodes, (unsigned)Timer_ms_since(start));
+    }
+}
+
+int main(int argc, char **argv){
+    bool weak = false, analyze = false, from_args = false;
+    char line[64];
+    int i;
+
+    Timer_init();
+    Solver_reset();
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-w") == 0) weak = true;
+        else if (strcmp(argv[i], "-a") == 0) analyze = true;
+    }
+
+    for (i = 1; i < argc; i++) {
+        if (argv[i][0] == '-') continue;
+        solve_position(argv[i], weak, analyze);
+        from_args = true;
+    }
+
+    if (!from_args) {
+        while (fgets(line, sizeof(line), stdin)) {
+            line[strcspn(line, "\r\n")] = '\0';
+            solve_position(line, weak, analyze);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * compare_search.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that compares the node counts of the root searches selectable with search_algorithm
+ *
+ * every algorithm searches the same fixed set of positions with iterative deepening up to the same depth and no time
+ * limit, starting each position from an empty transposition table and empty move ordering tables.
+ * the output lists the nodes visited per position and the reduction with respect to minimax(), together with how many
+ * positions got the same move as minimax() (equally deep searches find the same score, but they can pick different
+ * moves among equally scored ones)
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o compare_search host/tools/compare_search.c $ENGINE
+ * usage:
+ *     ./compare_search [depth ...]
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "stdio.h"
+#include "stdlib.h"
+
+// fixed position set, as move strings: no side can win or has to block on the next move
+static const char *COMPARE_POSITIONS[] = {
+    "",
+    "4",
+    "44",
+    "4453",
+    "4444",
+    "6712",
+    "43534",
+    "1234567",
+    "3354213",
+    "2223346",
+    "43443555",
+    "54344321",
+    "44444433",
+    "4453563322",
+    "1234567654",
+    "4436452151762",
+    "12345671234567",
+};
+#define NUM_COMPARE_POSITIONS (sizeof(COMPARE_POSITIONS) / sizeof(COMPARE_POSITIONS[0]))
+
+static const char *ALGORITHM_NAMES[] = {"minimax", "pvs", "mtdf"};
+#define NUM_ALGORITHMS 3
+
+static const int DEFAULT_DEPTHS[] = {6, 8, 10};
+
+int main(int argc, char **argv){
+    int num_depths = (argc > 1) ? argc - 1 : (int)(sizeof(DEFAULT_DEPTHS) / sizeof(DEFAULT_DEPTHS[0]));
+    int d, a;
+    unsigned i;
+
+    Timer_init();
+    for (d = 0; d < num_depths; d++) {
+        int depth = (argc > 1) ? atoi(argv[d + 1]) : DEFAULT_DEPTHS[d];
+        unsigned long long totals[NUM_ALGORITHMS] = {0};
+        unsigned same_move[NUM_ALGORITHMS] = {0};
+
+        printf("depth %d\n", depth);
+        printf("%-16s", "position");
+        for (a = 0; a < NUM_ALGORITHMS; a++) printf(" %12s mv", ALGORITHM_NAMES[a]);
+        printf("\n");
+
+        for (i = 0; i < NUM_COMPARE_POSITIONS; i++) {
+            Board_t board;
+            Move_t minimax_move = 0;
+            if (Position_load_board(&board, COMPARE_POSITIONS[i]) < 0) {
+                fprintf(stderr, "invalid position \"%s\"\n", COMPARE_POSITIONS[i]);
+                return 1;
+            }
+
+            printf("%-16s", COMPARE_POSITIONS[i][0] ? COMPARE_POSITIONS[i] : "(empty)");
+            for (a = 0; a < NUM_ALGORITHMS; a++) {
+                TT_clear();
+                MoveOrder_clear();
+                search_algorithm = (Algorithm_t)a;
+                Result_t r = iterative_deepening(&board, true, depth, UINT32_MAX);
+
+                if (a == ALGORITHM_MINIMAX) minimax_move = r.move;
+                if (r.move == minimax_move) same_move[a]++;
+                totals[a] += search_nodes;
+                printf(" %12lu %2d", (unsigned long)search_nodes, r.move + 1);
+            }
+            printf("\n");
+        }
+
+        printf("%-16s", "total");
+        for (a = 0; a < NUM_ALGORITHMS; a++) printf(" %12llu   ", totals[a]);
+        printf("\n%-16s", "vs minimax");
+        for (a = 0; a < NUM_ALGORITHMS; a++) printf(" %11.1f%%   ", 100.0 * totals[a] / totals[ALGORITHM_MINIMAX]);
+        printf("\n%-16s", "same move");
+        for (a = 0; a < NUM_ALGORITHMS; a++) printf(" %9u/%-2u   ", same_move[a], (unsigned)NUM_COMPARE_POSITIONS);
+        printf("\n\n");
+    }
+    return 0;
+}
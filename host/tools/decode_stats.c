@@ -0,0 +1,104 @@
+/*
+ * decode_stats.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* decoder of the search statistics records (include/searchstats.h)
+ *
+ * reads the records from a file, or from stdin if no file is given, and prints one line per move: the ply, the column
+ * (1 to 7) and how it was chosen, then the depth, the deepest ply, the nodes, the leaves and the total time, then the
+ * cutoffs by move index and the time below each root move by column. with -s it ends with the totals of the cutoffs.
+ * bytes that do not start a valid record are skipped, so the tool can be attached to the serial port at any time.
+ *
+ * build from the repository root:
+ *     gcc -O2 -DHOST_BUILD -I. -o decode_stats host/tools/decode_stats.c source/searchstats.c
+ * usage on the host, with a firmware built with -DSEARCH_STATS=1:
+ *     mkfifo /tmp/stats && ./decode_stats /tmp/stats &
+ *     CONNECT4_TELEMETRY=/tmp/stats ./connect4_host < host/scripts/game.txt
+ * usage with the LaunchPad (115200 baud 8N1):
+ *     stty -F /dev/ttyACM0 115200 raw && ./decode_stats /dev/ttyACM0
+ */
+
+#include "include/searchstats.h"
+#include "include/types.h"
+#include "stdio.h"
+#include "string.h"
+
+static const char *HOW[] = {"search", "win", "book", "ponder"};
+
+static void print_record(const StatsRecord_t *r){
+    Col_t c;
+    printf("ply %2d  col %d  %-6s  depth %2d  max ply %2d  nodes %9lu  leaves %9lu  %8.3f ms  cutoffs",
+           r->ply, r->move + 1, r->shortcut < sizeof(HOW) / sizeof(HOW[0]) ? HOW[r->shortcut] : "?", r->depth, r->max_ply,
+           (unsigned long)r->nodes, (unsigned long)r->leaves, r->total_us / 1000.0);
+    for (c = 0; c < NUM_COLS; c++) printf(" %lu", (unsigned long)r->cutoffs[c]);
+    printf("  root ms");
+    for (c = 0; c < NUM_COLS; c++) printf(" %.1f", r->root_us[c] / 1000.0);
+    printf("\n");
+}
+
+int main(int argc, char **argv){
+    FILE *in = stdin;
+    bool summary = false;
+    uint8_t buffer[STATS_RECORD_SIZE];
+    size_t filled = 0;
+    unsigned long records = 0, skipped = 0;
+    unsigned long long cutoffs[NUM_COLS] = {0};
+    int i, ch;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0) {
+            summary = true;
+        }
+        else if (argv[i][0] != '-' && in == stdin) {
+            in = fopen(argv[i], "rb");
+            if (!in) {
+                perror(argv[i]);
+                return 1;
+            }
+        }
+        else {
+            fprintf(stderr, "usage: %s [-s] [file]\n", argv[0]);
+            return 1;
+        }
+    }
+    // one line per record as soon as it arrives, also when the output is a pipe
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    while ((ch = getc(in)) != EOF) {
+        StatsRecord_t r;
+        buffer[filled++] = (uint8_t)ch;
+        if (filled < STATS_RECORD_SIZE) {
+            // wait for a sync byte before collecting a record
+            if (buffer[0] != STATS_SYNC) {
+                filled = 0;
+                skipped++;
+            }
+            continue;
+        }
+
+        if (Stats_decode(buffer, &r)) {
+            print_record(&r);
+            records++;
+            for (i = 0; i < NUM_COLS; i++) cutoffs[i] += r.cutoffs[i];
+            filled = 0;
+            continue;
+        }
+
+        // not a record: drop the first byte and look for the next sync byte in the rest
+        uint8_t *sync = memchr(buffer + 1, STATS_SYNC, STATS_RECORD_SIZE - 1);
+        skipped += sync ? (size_t)(sync - buffer) : STATS_RECORD_SIZE;
+        filled = sync ? STATS_RECORD_SIZE - (size_t)(sync - buffer) : 0;
+        memmove(buffer, sync ? sync : buffer, filled);
+    }
+
+    if (summary) {
+        unsigned long long total = 0;
+        for (i = 0; i < NUM_COLS; i++) total += cutoffs[i];
+        printf("%lu records, %lu bytes skipped, cutoffs by move index:", records, skipped);
+        for (i = 0; i < NUM_COLS; i++) printf(" %.1f%%", total ? 100.0 * cutoffs[i] / total : 0.0);
+        printf("\n");
+    }
+    return 0;
+}
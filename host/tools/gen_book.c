@@ -0,0 +1,228 @@
+/*
+ * gen_book.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that generates the opening book of include/openingbook.h
+ *
+ * the tool walks every game of the first plies in which the computer plays the book: at the computer's turns only the
+ * best move is followed, at the player's turns every move is. this is done both for the games the computer starts
+ * and for the games the player starts. the best move of every position is found by the exact solver with a strong
+ * solve, so the computer wins as fast as possible, or loses as late as possible, against perfect play.
+ * positions are merged with their mirror image, then a perfect hash is built for them and the tables are written to
+ * stdout as a C source file. solving the first plies exactly takes a long time, progress is printed on stderr
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o gen_book host/tools/gen_book.c host/source/solver.c $ENGINE
+ * usage:
+ *     ./gen_book [plies] > source/bookdata.c
+ */
+
+#include "include/types.h"
+#include "include/bitboard.h"
+#include "include/openingbook.h"
+#include "include/timer.h"
+#include "host/include/solver.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define DEFAULT_PLIES 8
+
+// displacements are stored on a byte
+#define MAX_DISPLACEMENTS 256
+
+typedef struct {
+    uint64_t key;
+    Move_t move;
+} BookPosition_t;
+
+static BookPosition_t *positions;
+static unsigned num_positions, max_positions;
+
+static Ticks_t start;
+
+// canonical key of a position, sets mirrored if it is the key of the mirror image
+static uint64_t canonical_key(const BitBoard_t *b, bool *mirrored){
+    BitBoard_t mirror;
+    uint64_t key = BitBoard_key(b);
+    BitBoard_mirror(&mirror, b);
+    *mirrored = BitBoard_key(&mirror) < key;
+    return *mirrored ? BitBoard_key(&mirror) : key;
+}
+
+static BookPosition_t *find_position(uint64_t key){
+    unsigned i;
+    for (i = 0; i < num_positions; i++) {
+        if (positions[i].key == key) return &positions[i];
+    }
+    return NULL;
+}
+
+static void add_position(uint64_t key, Move_t move){
+    if (num_positions == max_positions) {
+        max_positions = max_positions ? 2 * max_positions : 256;
+        positions = realloc(positions, max_positions * sizeof(BookPosition_t));
+        if (!positions) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    positions[num_positions].key = key;
+    positions[num_positions].move = move;
+    num_positions++;
+}
+
+static void visit(const BitBoard_t *b, bool computer_to_move, int plies){
+    Col_t c;
+
+    if (b->moves >= plies) return;
+
+    if (computer_to_move) {
+        bool mirrored;
+        uint64_t key = canonical_key(b, &mirrored);
+        SolverResult_t r;
+
+        // already visited, possibly through a transposition or as a mirror image
+        if (find_position(key)) return;
+
+        // immediate wins are played by choose_move() before looking at the book
+        for (c = 0; c < NUM_COLS; c++) {
+            if (BitBoard_can_play(b, c) && BitBoard_is_winning_move(b, c)) return;
+        }
+
+        Col_t best = Solver_best_move(b, false, &r);
+        add_position(key, mirrored ? (Move_t)(NUM_COLS - 1 - best) : (Move_t)best);
+        fprintf(stderr, "%4u positions, ply %d: move %d score %d, %llu nodes, %lu s\n", num_positions, b->moves,
+                best + 1, r.score, (unsigned long long)r.nodes, (unsigned long)(Timer_ms_since(start) / 1000));
+
+        BitBoard_t child = *b;
+        BitBoard_play(&child, best);
+        visit(&child, false, plies);
+    }
+    else {
+        for (c = 0; c < NUM_COLS; c++) {
+            if (!BitBoard_can_play(b, c) || BitBoard_is_winning_move(b, c)) continue;
+            BitBoard_t child = *b;
+            BitBoard_play(&child, c);
+            visit(&child, true, plies);
+        }
+    }
+}
+
+// hash and displace: buckets are placed from the largest to the smallest, each with the first displacement that
+// sends all its positions to free slots. returns false if some bucket has no such displacement
+static bool build_hash(uint16_t num_buckets, uint16_t num_slots, uint8_t *displacements, BookEntry_t *slots){
+    unsigned *bucket_of = malloc(num_positions * sizeof(unsigned));
+    unsigned *bucket_size = calloc(num_buckets, sizeof(unsigned));
+    unsigned *slot_of = malloc(num_positions * sizeof(unsigned));
+    unsigned i, j, size;
+    bool ok = true;
+
+    for (i = 0; i < num_slots; i++) slots[i] = BOOK_EMPTY_SLOT;
+    memset(displacements, 0, num_buckets);
+
+    for (i = 0; i < num_positions; i++) {
+        bucket_of[i] = Book_hash(positions[i].key, 0) % num_buckets;
+        bucket_size[bucket_of[i]]++;
+    }
+
+    for (size = num_positions; size > 0 && ok; size--) {
+        unsigned bucket;
+        for (bucket = 0; bucket < num_buckets && ok; bucket++) {
+            unsigned d;
+            if (bucket_size[bucket] != size) continue;
+
+            for (d = 0; d < MAX_DISPLACEMENTS; d++) {
+                bool fits = true;
+                for (i = 0; i < num_positions && fits; i++) {
+                    if (bucket_of[i] != bucket) continue;
+                    slot_of[i] = Book_hash(positions[i].key, d + 1) % num_slots;
+                    if (slots[slot_of[i]] != BOOK_EMPTY_SLOT) fits = false;
+                    for (j = 0; j < i && fits; j++) {
+                        if (bucket_of[j] == bucket && slot_of[j] == slot_of[i]) fits = false;
+                    }
+                }
+                if (fits) break;
+            }
+            if (d == MAX_DISPLACEMENTS) {
+                ok = false;
+                break;
+            }
+
+            displacements[bucket] = (uint8_t)d;
+            for (i = 0; i < num_positions; i++) {
+                if (bucket_of[i] != bucket) continue;
+                slots[slot_of[i]] = BOOK_ENTRY(BOOK_CHECK(Book_hash(positions[i].key, 0)), positions[i].move);
+            }
+        }
+    }
+
+    free(bucket_of);
+    free(bucket_size);
+    free(slot_of);
+    return ok;
+}
+
+static void print_table(const char *type, const char *name, const unsigned *values, unsigned n, const char *format){
+    unsigned i;
+    printf("const %s %s[%u] = {", type, name, n);
+    for (i = 0; i < n; i++) {
+        printf(i % 12 ? " " : "\n    ");
+        printf(format, values[i]);
+        printf(",");
+    }
+    printf("\n};\n");
+}
+
+int main(int argc, char **argv){
+    int plies = (argc > 1) ? atoi(argv[1]) : DEFAULT_PLIES;
+    BitBoard_t b;
+    unsigned i;
+
+    Timer_init();
+    Solver_reset();
+    start = Timer_now();
+
+    BitBoard_init(&b);
+    visit(&b, true, plies);
+    visit(&b, false, plies);
+
+    // about 2 positions per bucket and a load factor of 0.8, grown until every bucket fits
+    uint16_t num_buckets = (uint16_t)(num_positions / 2 + 1);
+    uint16_t num_slots = (uint16_t)(num_positions + num_positions / 4 + 1);
+    uint8_t *displacements = malloc(num_buckets);
+    BookEntry_t *slots = malloc(2 * num_positions * sizeof(BookEntry_t) + sizeof(BookEntry_t));
+    while (!build_hash(num_buckets, num_slots, displacements, slots)) {
+        num_slots++;
+        if (num_slots > 2 * num_positions + 1) {
+            fprintf(stderr, "no perfect hash found\n");
+            return 1;
+        }
+    }
+    fprintf(stderr, "%u positions, %u buckets, %u slots, %u bytes\n", num_positions, num_buckets, num_slots,
+            (unsigned)(num_buckets + num_slots * sizeof(BookEntry_t)));
+
+    unsigned *values = malloc((num_slots > num_buckets ? num_slots : num_buckets) * sizeof(unsigned));
+
+    printf("/*\n * bookdata.c\n *\n *  Generated by host/tools/gen_book.c, do not edit\n */\n\n");
+    printf("/* opening book of the first %d plies: %u positions, %u bytes of flash\n", plies, num_positions,
+           (unsigned)(num_buckets + num_slots * sizeof(BookEntry_t)));
+    printf(" * see include/openingbook.h for the format\n */\n\n");
+    printf("#include \"include/openingbook.h\"\n#include \"stdint.h\"\n\n");
+    printf("const uint8_t BOOK_PLIES = %d;\n", plies);
+    printf("const uint16_t BOOK_NUM_BUCKETS = %u;\n", num_buckets);
+    printf("const uint16_t BOOK_NUM_SLOTS = %u;\n\n", num_slots);
+    for (i = 0; i < num_buckets; i++) values[i] = displacements[i];
+    print_table("uint8_t", "book_displacements", values, num_buckets, "%3u");
+    printf("\n");
+    for (i = 0; i < num_slots; i++) values[i] = slots[i];
+    print_table("BookEntry_t", "book_slots", values, num_slots, "0x%04x");
+
+    free(values);
+    free(displacements);
+    free(slots);
+    free(positions);
+    return 0;
+}
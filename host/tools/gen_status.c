@@ -0,0 +1,202 @@
+/*
+ * gen_status.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that generates the status line bitmaps of include/statusbitmaps.h
+ *
+ * every message and every column number is rendered in 6x8 cells like g_sFontFixed6x8 draws it: the 5x7 glyph in the
+ * top left corner of the cell, a blank column on its right and a blank row below it. the glyphs are those of the
+ * fixed font, stored here by column (bit 0 at the top) for the characters the messages use, so that the tool builds
+ * without the graphics library. the tables are written to stdout as a C source file
+ *
+ * build from the repository root:
+ *     gcc -O2 -DHOST_BUILD -I. -o gen_status host/tools/gen_status.c
+ * usage:
+ *     ./gen_status > source/statusdata.c
+ * with -p the bitmaps are printed as text instead, to check them
+ */
+
+#include "include/statusbitmaps.h"
+#include "include/types.h"
+#include "stdbool.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define CELL_WIDTH  6
+#define GLYPH_WIDTH 5
+
+// texts of the messages, in the order of StatusMessage_t
+static const char *const TEXTS[NUM_STATUS_MESSAGES] = {
+    [STATUS_YOUR_MOVE] = "Your move: Yellow",
+    [STATUS_CALCULATING] = "Calculating Move",
+    [STATUS_RED_MOVES_TO] = "Red moves to: ",
+    [STATUS_YOU_CHOSE] = "You chose: ",
+    [STATUS_YOU_WON] = "You WON! :D",
+    [STATUS_YOU_LOST] = "You Lost :(",
+    [STATUS_DRAW] = "Draw",
+};
+
+static const char *const NAMES[NUM_STATUS_MESSAGES] = {
+    "your_move", "calculating", "red_moves_to", "you_chose", "you_won", "you_lost", "draw"
+};
+
+typedef struct {
+    char c;
+    uint8_t columns[GLYPH_WIDTH];
+} Glyph_t;
+
+static const Glyph_t FONT[] = {
+    {' ', {0x00, 0x00, 0x00, 0x00, 0x00}},
+    {'!', {0x00, 0x00, 0x5F, 0x00, 0x00}},
+    {'(', {0x00, 0x1C, 0x22, 0x41, 0x00}},
+    {')', {0x00, 0x41, 0x22, 0x1C, 0x00}},
+    {'0', {0x3E, 0x51, 0x49, 0x45, 0x3E}},
+    {'1', {0x00, 0x42, 0x7F, 0x40, 0x00}},
+    {'2', {0x42, 0x61, 0x51, 0x49, 0x46}},
+    {'3', {0x21, 0x41, 0x45, 0x4B, 0x31}},
+    {'4', {0x18, 0x14, 0x12, 0x7F, 0x10}},
+    {'5', {0x27, 0x45, 0x45, 0x45, 0x39}},
+    {'6', {0x3C, 0x4A, 0x49, 0x49, 0x30}},
+    {'7', {0x01, 0x71, 0x09, 0x05, 0x03}},
+    {'8', {0x36, 0x49, 0x49, 0x49, 0x36}},
+    {'9', {0x06, 0x49, 0x49, 0x29, 0x1E}},
+    {':', {0x00, 0x36, 0x36, 0x00, 0x00}},
+    {'C', {0x3E, 0x41, 0x41, 0x41, 0x22}},
+    {'D', {0x7F, 0x41, 0x41, 0x22, 0x1C}},
+    {'L', {0x7F, 0x40, 0x40, 0x40, 0x40}},
+    {'M', {0x7F, 0x02, 0x0C, 0x02, 0x7F}},
+    {'N', {0x7F, 0x04, 0x08, 0x10, 0x7F}},
+    {'O', {0x3E, 0x41, 0x41, 0x41, 0x3E}},
+    {'R', {0x7F, 0x09, 0x19, 0x29, 0x46}},
+    {'W', {0x3F, 0x40, 0x38, 0x40, 0x3F}},
+    {'Y', {0x07, 0x08, 0x70, 0x08, 0x07}},
+    {'a', {0x20, 0x54, 0x54, 0x54, 0x78}},
+    {'c', {0x38, 0x44, 0x44, 0x44, 0x20}},
+    {'d', {0x38, 0x44, 0x44, 0x48, 0x7F}},
+    {'e', {0x38, 0x54, 0x54, 0x54, 0x18}},
+    {'g', {0x0C, 0x52, 0x52, 0x52, 0x3E}},
+    {'h', {0x7F, 0x08, 0x04, 0x04, 0x78}},
+    {'i', {0x00, 0x44, 0x7D, 0x40, 0x00}},
+    {'l', {0x00, 0x41, 0x7F, 0x40, 0x00}},
+    {'m', {0x7C, 0x04, 0x18, 0x04, 0x78}},
+    {'n', {0x7C, 0x08, 0x04, 0x04, 0x78}},
+    {'o', {0x38, 0x44, 0x44, 0x44, 0x38}},
+    {'r', {0x7C, 0x08, 0x04, 0x04, 0x08}},
+    {'s', {0x48, 0x54, 0x54, 0x54, 0x20}},
+    {'t', {0x04, 0x3F, 0x44, 0x40, 0x20}},
+    {'u', {0x3C, 0x40, 0x40, 0x20, 0x7C}},
+    {'v', {0x1C, 0x20, 0x40, 0x20, 0x1C}},
+    {'w', {0x3C, 0x40, 0x30, 0x40, 0x3C}},
+};
+
+static const Glyph_t *find_glyph(char c){
+    size_t i;
+    for (i = 0; i < sizeof(FONT) / sizeof(FONT[0]); i++) {
+        if (FONT[i].c == c) return &FONT[i];
+    }
+    fprintf(stderr, "no glyph for '%c'\n", c);
+    exit(1);
+}
+
+// renders a text in bits, rows of STATUS_ROW_BYTES(width) bytes, and returns its width
+static uint8_t render(const char *text, uint8_t *bits){
+    uint8_t width = (uint8_t)(strlen(text) * CELL_WIDTH);
+    size_t row_bytes = STATUS_ROW_BYTES(width);
+    size_t i;
+    int x, y;
+
+    memset(bits, 0, row_bytes * STATUS_BITMAP_HEIGHT);
+    for (i = 0; text[i]; i++) {
+        const Glyph_t *g = find_glyph(text[i]);
+        for (x = 0; x < GLYPH_WIDTH; x++) {
+            for (y = 0; y < STATUS_BITMAP_HEIGHT; y++) {
+                int px = (int)i * CELL_WIDTH + x;
+                if ((g->columns[x] >> y) & 1) bits[y * row_bytes + px / 8] |= (uint8_t)(0x80 >> (px % 8));
+            }
+        }
+    }
+    return width;
+}
+
+static void print_bitmap(const char *name, const uint8_t *bits, uint8_t width){
+    size_t row_bytes = STATUS_ROW_BYTES(width);
+    size_t i;
+
+    printf("static const uint8_t %s[%zu] = {", name, row_bytes * STATUS_BITMAP_HEIGHT);
+    for (i = 0; i < row_bytes * STATUS_BITMAP_HEIGHT; i++) {
+        if (i % row_bytes == 0) printf("\n   ");
+        printf(" 0x%02x,", bits[i]);
+    }
+    printf("\n};\n\n");
+}
+
+static void preview(const char *text, const uint8_t *bits, uint8_t width){
+    size_t row_bytes = STATUS_ROW_BYTES(width);
+    int x, y;
+
+    printf("%s\n", text);
+    for (y = 0; y < STATUS_BITMAP_HEIGHT; y++) {
+        for (x = 0; x < width; x++) putchar((bits[y * row_bytes + x / 8] >> (7 - x % 8)) & 1 ? '#' : '.');
+        putchar('\n');
+    }
+}
+
+int main(int argc, char **argv){
+    static uint8_t bits[NUM_STATUS_MESSAGES + NUM_COLS][STATUS_ROW_BYTES(255) * STATUS_BITMAP_HEIGHT];
+    uint8_t widths[NUM_STATUS_MESSAGES];
+    char digits[NUM_COLS][2];
+    bool print = argc > 1 && strcmp(argv[1], "-p") == 0;
+    size_t total = 0;
+    int i;
+
+    if (argc > 2 || (argc == 2 && !print)) {
+        fprintf(stderr, "usage: %s [-p]\n", argv[0]);
+        return 1;
+    }
+
+    for (i = 0; i < NUM_STATUS_MESSAGES; i++) {
+        widths[i] = render(TEXTS[i], bits[i]);
+        total += STATUS_ROW_BYTES(widths[i]) * STATUS_BITMAP_HEIGHT;
+        if (print) preview(TEXTS[i], bits[i], widths[i]);
+    }
+    for (i = 0; i < NUM_COLS; i++) {
+        digits[i][0] = (char)('1' + i);
+        digits[i][1] = '\0';
+        render(digits[i], bits[NUM_STATUS_MESSAGES + i]);
+        total += STATUS_ROW_BYTES(CELL_WIDTH) * STATUS_BITMAP_HEIGHT;
+        if (print) preview(digits[i], bits[NUM_STATUS_MESSAGES + i], CELL_WIDTH);
+    }
+    if (print) return 0;
+
+    printf("/*\n * statusdata.c\n *\n *  Generated by host/tools/gen_status.c, do not edit\n */\n\n");
+    printf("/* status line bitmaps: %d messages and %d digits, %zu bytes of flash\n", NUM_STATUS_MESSAGES, NUM_COLS,
+           total);
+    printf(" * see include/statusbitmaps.h for the format\n */\n\n");
+    printf("#include \"include/statusbitmaps.h\"\n#include \"stdint.h\"\n\n");
+
+    printf("const char *const STATUS_TEXTS[NUM_STATUS_MESSAGES] = {\n");
+    for (i = 0; i < NUM_STATUS_MESSAGES; i++) printf("    \"%s\",\n", TEXTS[i]);
+    printf("};\n\n");
+
+    for (i = 0; i < NUM_STATUS_MESSAGES; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "status_%s", NAMES[i]);
+        print_bitmap(name, bits[i], widths[i]);
+    }
+    for (i = 0; i < NUM_COLS; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "status_digit_%d", i + 1);
+        print_bitmap(name, bits[NUM_STATUS_MESSAGES + i], CELL_WIDTH);
+    }
+
+    printf("const StatusBitmap_t STATUS_MESSAGES[NUM_STATUS_MESSAGES] = {\n");
+    for (i = 0; i < NUM_STATUS_MESSAGES; i++) printf("    {%u, status_%s},\n", widths[i], NAMES[i]);
+    printf("};\n\n");
+    printf("const StatusBitmap_t STATUS_DIGITS[NUM_COLS] = {\n");
+    for (i = 0; i < NUM_COLS; i++) printf("    {%d, status_digit_%d},\n", CELL_WIDTH, i + 1);
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,315 @@
+/*
+ * tournament.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that plays a match between two engine configurations and estimates their Elo difference
+ *
+ * an engine is choose_move(), the function fn_CALCULATING_MOVE() uses on the device, with its own settings: search
+ * depth, time budget per move, root algorithm and threat evaluation. the games start from random openings generated
+ * from a fixed seed, and every opening is played twice with the colors swapped, so neither engine profits from a
+ * lucky opening or from moving first.
+ *
+ * the games are played by worker threads, each on its own board. the search state is per thread on host builds, and
+ * every worker gives each engine its own transposition table (TT_create(), TT_select()), which it keeps between the
+ * moves of a game like the device does. the move ordering tables are emptied before every move, so that the engines
+ * do not learn from each other's searches.
+ *
+ * the report gives the wins, draws and losses of the first engine, its score and the Elo difference with a 95%
+ * confidence interval, and the average time and nodes per searched move of each engine (moves played from the book
+ * or as immediate wins are counted apart)
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o tournament host/tools/tournament.c $ENGINE -lm -lpthread
+ * usage:
+ *     ./tournament [-g games] [-t threads] [-o opening plies] [-s seed] engine1 engine2
+ * an engine is a comma separated list of settings, all optional:
+ *     depth=N                      deepest iteration, 42 by default
+ *     time=MS                      time budget per move in milliseconds, 0 for no limit, 100 by default
+ *     algorithm=minimax|pvs|mtdf   root search, see Algorithm_t
+ *     threats=on|off               threat_score() at the leaves, see eval_threats
+ * e.g. ./tournament -g 2000 depth=6,time=0 depth=8,time=0
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/bitboard.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "math.h"
+#include "pthread.h"
+#include "unistd.h"
+
+#define DEFAULT_GAMES 1000
+#define DEFAULT_OPENING_PLIES 4
+#define DEFAULT_SEED 0xC4C4C4C4u
+#define DEFAULT_TIME_MS 100
+#define MAX_THREADS 256
+
+static const char *ALGORITHM_NAMES[] = {"minimax", "pvs", "mtdf"};
+#define NUM_ALGORITHMS 3
+
+// settings of an engine
+typedef struct {
+    const char *name;
+    int max_depth;
+    uint32_t budget_ms;
+    Algorithm_t algorithm;
+    bool threats;
+} Engine_t;
+
+// what an engine did during the match
+typedef struct {
+    unsigned long searches;     // moves chosen by a search
+    unsigned long shortcuts;    // immediate wins and book moves
+    unsigned long long nodes;
+    double seconds;             // time of the searches
+} EngineStats_t;
+
+static Engine_t engines[2];
+
+// openings, as move strings: opening i is played by games 2i and 2i + 1
+static char (*openings)[NUM_COLS * NUM_ROWS + 1];
+static int num_games;
+
+// shared by the workers, under lock: next game to play and the totals
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static int next_game;
+static int wins, draws, losses;     // of engine 0
+static EngineStats_t totals[2];
+
+static uint32_t rng_state;
+
+static bool parse_engine(char *spec, Engine_t *e){
+    char *setting;
+
+    e->name = strdup(spec);
+    e->max_depth = HARD_MAX_DEPTH;
+    e->budget_ms = DEFAULT_TIME_MS;
+    e->algorithm = SEARCH_ALGORITHM;
+    e->threats = EVAL_THREATS;
+
+    for (setting = strtok(spec, ","); setting; setting = strtok(NULL, ",")) {
+        char *value = strchr(setting, '=');
+        int a;
+        if (!value) return false;
+        *value++ = '\0';
+
+        if (strcmp(setting, "depth") == 0) {
+            e->max_depth = atoi(value);
+            if (e->max_depth < 1) return false;
+        }
+        else if (strcmp(setting, "time") == 0) {
+            e->budget_ms = (uint32_t)strtoul(value, NULL, 10);
+            if (e->budget_ms == 0) e->budget_ms = UINT32_MAX;
+        }
+        else if (strcmp(setting, "algorithm") == 0) {
+            for (a = 0; a < NUM_ALGORITHMS && strcmp(value, ALGORITHM_NAMES[a]) != 0; a++);
+            if (a == NUM_ALGORITHMS) return false;
+            e->algorithm = (Algorithm_t)a;
+        }
+        else if (strcmp(setting, "threats") == 0) {
+            if (strcmp(value, "on") == 0) e->threats = true;
+            else if (strcmp(value, "off") == 0) e->threats = false;
+            else return false;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// plays a game, returns 1 if engine 0 won, 0 for a draw and -1 if it lost
+static int play_game(int game, TTTable_t *tables[2], EngineStats_t stats[2]){
+    // engine 0 moves first in the even games, p1 is always the player who moves first
+    int first = game % 2;
+    Board_t b;
+    int e;
+
+    Position_load_board(&b, openings[game / 2]);
+    for (e = 0; e < 2; e++) {
+        TT_select(tables[e]);
+        TT_clear();
+    }
+
+    while (!Board_full(&b)) {
+        bool first_player = (b.moves % 2 == 0);
+        const Engine_t *engine;
+        e = first_player ? first : 1 - first;
+        engine = &engines[e];
+
+        TT_select(tables[e]);
+        MoveOrder_clear();
+        search_algorithm = engine->algorithm;
+        eval_threats = engine->threats;
+
+        Ticks_t start = Timer_now();
+        Col_t move = choose_move(&b, first_player, engine->max_depth, engine->budget_ms);
+        double elapsed = Timer_ticks_to_us(Timer_now() - start) * 1e-6;
+
+        if (search_depth > 0) {
+            stats[e].searches++;
+            stats[e].nodes += search_nodes;
+            stats[e].seconds += elapsed;
+        }
+        else {
+            stats[e].shortcuts++;
+        }
+
+        Score_t delta = delta_score(&b, move, b.height[move], first_player);
+        Board_make_move(&b, move, first_player, delta);
+        if (delta == SCORE_MAX || delta == SCORE_MIN) return (e == 0) ? 1 : -1;
+    }
+    return 0;
+}
+
+static void *worker(void *arg){
+    TTTable_t *tables[2] = {TT_create(), TT_create()};
+    EngineStats_t stats[2];
+    int e;
+    (void)arg;
+
+    if (!tables[0] || !tables[1]) {
+        fprintf(stderr, "not enough memory for the transposition tables\n");
+        exit(1);
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&lock);
+        int game = next_game++;
+        pthread_mutex_unlock(&lock);
+        if (game >= num_games) break;
+
+        memset(stats, 0, sizeof(stats));
+        int result = play_game(game, tables, stats);
+
+        pthread_mutex_lock(&lock);
+        if (result > 0) wins++;
+        else if (result < 0) losses++;
+        else draws++;
+        for (e = 0; e < 2; e++) {
+            totals[e].searches += stats[e].searches;
+            totals[e].shortcuts += stats[e].shortcuts;
+            totals[e].nodes += stats[e].nodes;
+            totals[e].seconds += stats[e].seconds;
+        }
+        int played = wins + draws + losses;
+        if (played % 100 == 0) fprintf(stderr, "%d/%d games: +%d =%d -%d\n", played, num_games, wins, draws, losses);
+        pthread_mutex_unlock(&lock);
+    }
+
+    TT_destroy(tables[0]);
+    TT_destroy(tables[1]);
+    return NULL;
+}
+
+// Elo difference that gives an expected score, as a fraction of the points
+static double elo(double score){
+    return -400.0 * log10(1.0 / score - 1.0);
+}
+
+static void report(void){
+    int games = wins + draws + losses;
+    double score = (wins + 0.5 * draws) / games;
+    int e;
+
+    printf("engine 1: %s\n", engines[0].name);
+    printf("engine 2: %s\n", engines[1].name);
+    printf("%d games: engine 1 won %d, drew %d, lost %d, score %.1f%%\n", games, wins, draws, losses, 100 * score);
+
+    // 95% confidence interval of the score from the variance of the result of a game
+    double variance = (wins * (1 - score) * (1 - score) + draws * (0.5 - score) * (0.5 - score) +
+                       losses * score * score) / games;
+    double margin = 1.96 * sqrt(variance / games);
+    if (score <= 0 || score >= 1) {
+        printf("Elo difference: %sinfinite\n", score <= 0 ? "-" : "+");
+    }
+    else {
+        double low = score - margin, high = score + margin;
+        printf("Elo difference: %+.1f, 95%% interval ", elo(score));
+        if (low > 0) printf("[%+.1f, ", elo(low));
+        else printf("[-inf, ");
+        if (high < 1) printf("%+.1f]\n", elo(high));
+        else printf("+inf]\n");
+    }
+
+    for (e = 0; e < 2; e++) {
+        const EngineStats_t *t = &totals[e];
+        printf("engine %d: %lu searches, %.2f ms and %.0f nodes per search, %lu moves without search\n", e + 1,
+               t->searches, t->searches ? 1000 * t->seconds / t->searches : 0.0,
+               t->searches ? (double)t->nodes / t->searches : 0.0, t->shortcuts);
+    }
+}
+
+int main(int argc, char **argv){
+    pthread_t threads[MAX_THREADS];
+    int num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int opening_plies = DEFAULT_OPENING_PLIES;
+    int num_engines = 0;
+    int i;
+
+    num_games = DEFAULT_GAMES;
+    rng_state = DEFAULT_SEED;
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            num_games = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            num_threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            opening_plies = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            rng_state = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (num_engines < 2 && argv[i][0] != '-') {
+            if (!parse_engine(argv[i], &engines[num_engines])) {
+                fprintf(stderr, "invalid engine \"%s\"\n", engines[num_engines].name);
+                return 1;
+            }
+            num_engines++;
+        }
+        else {
+            num_engines = -1;
+            break;
+        }
+    }
+    if (num_engines != 2) {
+        fprintf(stderr, "usage: %s [-g games] [-t threads] [-o opening plies] [-s seed] engine1 engine2\n", argv[0]);
+        return 1;
+    }
+    if (num_games < 2 || opening_plies < 0 || opening_plies > 20) {
+        fprintf(stderr, "invalid number of games or opening plies\n");
+        return 1;
+    }
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+    if (rng_state == 0) rng_state = DEFAULT_SEED;
+
+    // every opening is played with both colors
+    num_games += num_games % 2;
+    openings = malloc((size_t)(num_games / 2) * sizeof(*openings));
+    if (!openings) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (i = 0; i < num_games / 2; i++) {
+        while (!Position_random(openings[i], opening_plies, true, &rng_state));
+    }
+
+    Timer_init();
+    for (i = 0; i < num_threads; i++) pthread_create(&threads[i], NULL, worker, NULL);
+    for (i = 0; i < num_threads; i++) pthread_join(threads[i], NULL);
+
+    report();
+    return 0;
+}
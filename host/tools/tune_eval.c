@@ -0,0 +1,373 @@
+/*
+ * tune_eval.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* host tool that fits the weights of the static evaluation (eval_weights, see include/connect4algorithm.h)
+ *
+ * the tool has three commands:
+ * - solve: writes positions reached by random moves, labeled with their exact result by the weak solver
+ * - selfplay: plays games of the engine against itself, every position is labeled with the result of its game
+ * - fit: Texel tuning of the weights on one or more of these datasets, writes include/evalweights.h
+ *
+ * a dataset has one position per line, "moves,result": the move string of the position and the result for the player
+ * to move, 1 for a win, 0.5 for a draw and 0 for a loss.
+ *
+ * the evaluation of a leaf is b->score + threat_score(), and every term of it is a weight times a count, so the
+ * evaluation is linear in the weights: the fit first measures how many times each weight counts in every position by
+ * evaluating it with the real engine code once per weight, and checks that the sum matches the evaluation with the
+ * current weights. the fit then minimizes the mean squared error between the results and sigmoid(K * evaluation):
+ * K is chosen first for the current weights, then every weight is moved by one step up or down as long as the error
+ * decreases. the error is computed by worker threads, each on a slice of the positions.
+ *
+ * build from the repository root (see README.md for ENGINE):
+ *     gcc -O2 -DHOST_BUILD -DNDEBUG -I. -o tune_eval host/tools/tune_eval.c host/source/solver.c $ENGINE -lm -lpthread
+ * usage:
+ *     ./tune_eval solve [positions] [min plies] [max plies] > solved.txt
+ *     ./tune_eval selfplay [games] [depth] > selfplay.txt
+ *     ./tune_eval fit [-t threads] dataset... > include/evalweights.h
+ */
+
+#include "include/types.h"
+#include "include/board.h"
+#include "include/bitboard.h"
+#include "include/connect4algorithm.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "host/include/position.h"
+#include "host/include/solver.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "math.h"
+#include "pthread.h"
+
+#define DEFAULT_SOLVE_POSITIONS 10000
+#define DEFAULT_MIN_PLIES 12
+#define DEFAULT_MAX_PLIES 36
+#define DEFAULT_GAMES 1000
+#define DEFAULT_SELFPLAY_DEPTH 4
+#define DEFAULT_THREADS 4
+#define MAX_THREADS 64
+
+// random moves at the start of every self-play game, so that the games differ
+#define SELFPLAY_RANDOM_PLIES 6
+
+// upper bounds of the weights: the window weights are kept small enough that b->score can not overflow and that no
+// window reaches EVAL_WIN
+static const Score_t MAX_WEIGHT[NUM_EVAL_WEIGHTS] = {40, 40, 40, 40, 40, 40, 200, 200, 200, 200};
+
+static const char *WEIGHT_NAMES[NUM_EVAL_WEIGHTS] = {
+    "WEIGHT_EMPTY", "WEIGHT_OWN_1", "WEIGHT_OWN_2", "WEIGHT_ENEMY_1", "WEIGHT_ENEMY_2", "WEIGHT_ENEMY_3",
+    "WEIGHT_THREAT_GOOD", "WEIGHT_THREAT_WEAK", "WEIGHT_THREAT_IMMEDIATE", "WEIGHT_THREAT_FORCING",
+};
+
+// a position of the fit: evaluation = base + sum of counts[i] * weight i
+typedef struct {
+    float base;
+    float counts[NUM_EVAL_WEIGHTS];
+    float result;
+} Sample_t;
+
+static Sample_t *samples;
+static size_t num_samples, max_samples;
+
+static uint32_t rng_state = 0x7E5A1u;
+
+static const char *result_string(int result){
+    return result > 0 ? "1" : (result < 0 ? "0" : "0.5");
+}
+
+static int command_solve(int positions, int min_plies, int max_plies){
+    int i;
+    Ticks_t start = Timer_now();
+
+    Solver_reset();
+    for (i = 0; i < positions; i++) {
+        char moves[NUM_COLS * NUM_ROWS + 1];
+        BitBoard_t b;
+        SolverResult_t r;
+        int ply;
+        do {
+            ply = min_plies + (int)(Position_rng_next(&rng_state) % (max_plies - min_plies + 1));
+        } while (!Position_random(moves, ply, false, &rng_state));
+        Position_load_bitboard(&b, moves);
+
+        Solver_solve(&b, true, &r);
+        printf("%s,%s\n", moves, result_string(r.result));
+        if ((i + 1) % 1000 == 0)
+            fprintf(stderr, "%d positions, %lu s\n", i + 1, (unsigned long)(Timer_ms_since(start) / 1000));
+    }
+    return 0;
+}
+
+static int command_selfplay(int games, int depth){
+    int g;
+    for (g = 0; g < games; g++) {
+        char moves[NUM_COLS * NUM_ROWS + 1];
+        Board_t b;
+        int ply, result = 0;
+
+        // the engine plays both sides on the same board, p1 is the player who started
+        while (!Position_random(moves, SELFPLAY_RANDOM_PLIES, false, &rng_state));
+        Position_load_board(&b, moves);
+        TT_clear();
+        MoveOrder_clear();
+
+        for (ply = SELFPLAY_RANDOM_PLIES; ply < NUM_COLS * NUM_ROWS; ply++) {
+            bool first_player = (ply % 2 == 0);
+            Result_t r = iterative_deepening(&b, first_player, depth, UINT32_MAX);
+            Score_t delta = delta_score(&b, r.move, b.height[r.move], first_player);
+            Board_make_move(&b, r.move, first_player, delta);
+            moves[ply] = (char)('1' + r.move);
+            if (delta == SCORE_MAX || delta == SCORE_MIN) {
+                result = first_player ? 1 : -1;
+                break;
+            }
+        }
+
+        // every position of the game before its last move, labeled for the player to move
+        int last = (ply < NUM_COLS * NUM_ROWS) ? ply : NUM_COLS * NUM_ROWS - 1;
+        for (ply = SELFPLAY_RANDOM_PLIES; ply <= last; ply++) {
+            printf("%.*s,%s\n", ply, moves, result_string((ply % 2 == 0) ? result : -result));
+        }
+        if ((g + 1) % 100 == 0) fprintf(stderr, "%d games\n", g + 1);
+    }
+    return 0;
+}
+
+// evaluation of a position with the current weights, from the point of view of the player to move
+static bool evaluate(const char *moves, double *score){
+    Board_t b;
+    if (Position_load_board(&b, moves) < 0) return false;
+    *score = b.score + (eval_threats ? threat_score(&b, true) : 0);
+    return true;
+}
+
+static bool add_sample(const char *moves, float result){
+    Score_t saved[NUM_EVAL_WEIGHTS];
+    Sample_t s;
+    double base, score = 0, sum;
+    int i;
+
+    memcpy(saved, eval_weights, sizeof(saved));
+
+    memset(eval_weights, 0, sizeof(saved));
+    if (!evaluate(moves, &base)) {
+        memcpy(eval_weights, saved, sizeof(saved));
+        return false;
+    }
+    s.base = (float)base;
+    sum = base;
+    for (i = 0; i < NUM_EVAL_WEIGHTS; i++) {
+        eval_weights[i] = 1;
+        evaluate(moves, &score);
+        eval_weights[i] = 0;
+        s.counts[i] = (float)(score - base);
+        sum += s.counts[i] * saved[i];
+    }
+    s.result = result;
+
+    // the evaluation must be linear in the weights
+    memcpy(eval_weights, saved, sizeof(saved));
+    evaluate(moves, &score);
+    if (fabs(score - sum) > 0.5) {
+        fprintf(stderr, "position %s: evaluation %.0f is not linear in the weights (%.0f)\n", moves, score, sum);
+        exit(1);
+    }
+
+    if (num_samples == max_samples) {
+        max_samples = max_samples ? 2 * max_samples : 65536;
+        samples = realloc(samples, max_samples * sizeof(Sample_t));
+        if (!samples) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    samples[num_samples++] = s;
+    return true;
+}
+
+static int load_dataset(const char *path){
+    char line[128];
+    FILE *f = fopen(path, "r");
+    int n = 0;
+    if (!f) {
+        fprintf(stderr, "can not open %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        char *comma = strchr(line, ',');
+        if (!comma) continue;
+        *comma = '\0';
+        if (add_sample(line, (float)atof(comma + 1))) n++;
+    }
+    fclose(f);
+    return n;
+}
+
+
+// the error is summed by worker threads over slices of the samples
+typedef struct {
+    size_t begin, end;
+    const double *weights;
+    double k;
+    double error;
+} Slice_t;
+
+static int num_threads = DEFAULT_THREADS;
+
+static void *slice_error(void *arg){
+    Slice_t *slice = arg;
+    double error = 0;
+    size_t n;
+    int i;
+    for (n = slice->begin; n < slice->end; n++) {
+        const Sample_t *s = &samples[n];
+        double score = s->base;
+        for (i = 0; i < NUM_EVAL_WEIGHTS; i++) score += s->counts[i] * slice->weights[i];
+        double d = s->result - 1.0 / (1.0 + exp(-slice->k * score));
+        error += d * d;
+    }
+    slice->error = error;
+    return NULL;
+}
+
+static double mean_error(const Score_t *weights, double k){
+    pthread_t threads[MAX_THREADS];
+    Slice_t slices[MAX_THREADS];
+    double w[NUM_EVAL_WEIGHTS];
+    double error = 0;
+    int t;
+
+    for (t = 0; t < NUM_EVAL_WEIGHTS; t++) w[t] = weights[t];
+    for (t = 0; t < num_threads; t++) {
+        slices[t].begin = num_samples * t / num_threads;
+        slices[t].end = num_samples * (t + 1) / num_threads;
+        slices[t].weights = w;
+        slices[t].k = k;
+        pthread_create(&threads[t], NULL, slice_error, &slices[t]);
+    }
+    for (t = 0; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+        error += slices[t].error;
+    }
+    return error / num_samples;
+}
+
+// golden section search of the K that fits the current weights best
+static double fit_k(const Score_t *weights){
+    const double ratio = (sqrt(5.0) - 1) / 2;
+    double lo = 0.0001, hi = 0.5;
+    double a = hi - ratio * (hi - lo), b = lo + ratio * (hi - lo);
+    double fa = mean_error(weights, a), fb = mean_error(weights, b);
+    while (hi - lo > 1e-6) {
+        if (fa < fb) {
+            hi = b; b = a; fb = fa;
+            a = hi - ratio * (hi - lo);
+            fa = mean_error(weights, a);
+        } else {
+            lo = a; a = b; fa = fb;
+            b = lo + ratio * (hi - lo);
+            fb = mean_error(weights, b);
+        }
+    }
+    return (lo + hi) / 2;
+}
+
+static int command_fit(int num_paths, char **paths){
+    Score_t weights[NUM_EVAL_WEIGHTS];
+    int i;
+    bool improved = true;
+
+    for (i = 0; i < num_paths; i++) {
+        int n = load_dataset(paths[i]);
+        if (n < 0) return 1;
+        fprintf(stderr, "%s: %d positions\n", paths[i], n);
+    }
+    if (num_samples == 0) {
+        fprintf(stderr, "no positions to fit\n");
+        return 1;
+    }
+
+    memcpy(weights, eval_weights, sizeof(weights));
+    double k = fit_k(weights);
+    double start_error = mean_error(weights, k);
+    double error = start_error;
+    fprintf(stderr, "K = %.5f, error %.6f\n", k, error);
+
+    // local search: move every weight by one step while the error decreases
+    while (improved) {
+        improved = false;
+        for (i = 0; i < NUM_EVAL_WEIGHTS; i++) {
+            int step;
+            for (step = 1; step >= -1; step -= 2) {
+                Score_t old = weights[i];
+                if (old + step < 0 || old + step > MAX_WEIGHT[i]) continue;
+                weights[i] = old + step;
+                double e = mean_error(weights, k);
+                if (e < error) {
+                    error = e;
+                    improved = true;
+                    break;
+                }
+                weights[i] = old;
+            }
+        }
+        fprintf(stderr, "error %.6f:", error);
+        for (i = 0; i < NUM_EVAL_WEIGHTS; i++) fprintf(stderr, " %d", weights[i]);
+        fprintf(stderr, "\n");
+    }
+
+    printf("/*\n * evalweights.h\n *\n *  Generated by host/tools/tune_eval.c, do not edit\n */\n\n");
+    printf("/* weights of the static evaluation, in EvalWeight_t order (see include/connect4algorithm.h)\n");
+    printf(" * fitted on %lu positions with K = %.5f, mean squared error %.6f (%.6f before the fit)\n */\n\n",
+           (unsigned long)num_samples, k, error, start_error);
+    printf("#ifndef INCLUDE_EVALWEIGHTS_H_\n#define INCLUDE_EVALWEIGHTS_H_\n\n");
+    printf("#define EVAL_WEIGHTS { \\\n");
+    for (i = 0; i < NUM_EVAL_WEIGHTS; i++) {
+        char value[8];
+        snprintf(value, sizeof(value), "%d,", weights[i]);
+        printf("    %-5s /* %s */ \\\n", value, WEIGHT_NAMES[i]);
+    }
+    printf("}\n\n#endif /* INCLUDE_EVALWEIGHTS_H_ */\n");
+    return 0;
+}
+
+int main(int argc, char **argv){
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s solve|selfplay|fit ...\n", argv[0]);
+        return 1;
+    }
+    Timer_init();
+
+    if (strcmp(argv[1], "solve") == 0) {
+        int positions = (argc > 2) ? atoi(argv[2]) : DEFAULT_SOLVE_POSITIONS;
+        int min_plies = (argc > 3) ? atoi(argv[3]) : DEFAULT_MIN_PLIES;
+        int max_plies = (argc > 4) ? atoi(argv[4]) : DEFAULT_MAX_PLIES;
+        if (min_plies < 0 || max_plies < min_plies || max_plies >= NUM_COLS * NUM_ROWS) {
+            fprintf(stderr, "invalid ply range\n");
+            return 1;
+        }
+        return command_solve(positions, min_plies, max_plies);
+    }
+    if (strcmp(argv[1], "selfplay") == 0) {
+        int games = (argc > 2) ? atoi(argv[2]) : DEFAULT_GAMES;
+        int depth = (argc > 3) ? atoi(argv[3]) : DEFAULT_SELFPLAY_DEPTH;
+        return command_selfplay(games, depth);
+    }
+    if (strcmp(argv[1], "fit") == 0) {
+        int first = 2;
+        if (argc > 3 && strcmp(argv[2], "-t") == 0) {
+            num_threads = atoi(argv[3]);
+            if (num_threads < 1) num_threads = 1;
+            if (num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+            first = 4;
+        }
+        return command_fit(argc - first, argv + first);
+    }
+    fprintf(stderr, "unknown command \"%s\"\n", argv[1]);
+    return 1;
+}
@@ -0,0 +1,232 @@
+/*
+ * bitboard.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_BITBOARD_H_
+#define INCLUDE_BITBOARD_H_
+
+
+/* packed bitboard representation of a connect 4 board
+ *
+ * the board is stored column-major in a single 64-bit word: column c occupies bits [c*BB_HEIGHT1, c*BB_HEIGHT1 + NUM_ROWS),
+ * bit 0 of a column being its lowest cell. every column has one extra sentinel row on top that is always empty, so that
+ * shifting a line of pieces never carries it over into the next column. with 7 columns of 7 bits the board uses 49 bits.
+ *
+ *  position: pieces of the player who is about to move
+ *  mask:     every occupied cell, no matter who owns it
+ *  moves:    number of pieces on the board
+ *
+ * the pieces of the player who moved last are position ^ mask, so a move only has to flip position and add a bit to mask
+ */
+typedef struct {
+    uint64_t position;
+    uint64_t mask;
+    uint8_t moves;
+} BitBoard_t;
+
+// bits per column, including the sentinel row
+#define BB_HEIGHT1 (NUM_ROWS + 1)
+
+// lowest cell of column c and the whole playable part of column c
+#define BB_BOTTOM(c) ((uint64_t)1 << ((c) * BB_HEIGHT1))
+#define BB_TOP(c) ((uint64_t)1 << (NUM_ROWS - 1 + (c) * BB_HEIGHT1))
+#define BB_COLUMN_MASK(c) ((((uint64_t)1 << NUM_ROWS) - 1) << ((c) * BB_HEIGHT1))
+
+// lowest cell of every column and every playable cell of the board (sentinel rows excluded)
+#define BB_BOTTOM_MASK ((uint64_t)0x0000040810204081ULL)
+#define BB_BOARD_MASK (BB_BOTTOM_MASK * ((1ULL << NUM_ROWS) - 1))
+
+
+/// @brief Checks whether a set of pieces contains four aligned pieces.
+///
+/// Each direction is tested with two shift-and-AND steps: the first
+/// keeps the pieces that have a neighbour in that direction, the second
+/// keeps the pairs of pairs. The sentinel row stops vertical and
+/// diagonal lines from wrapping into the next column.
+///
+/// @param pos Bitboard of the pieces of a single player.
+///
+/// @return true if pos contains a horizontal, vertical or diagonal line of 4.
+static inline bool BitBoard_alignment(uint64_t pos)
+{
+    uint64_t m;
+
+    // horizontal
+    m = pos & (pos >> BB_HEIGHT1);
+    if (m & (m >> (2 * BB_HEIGHT1))) return true;
+
+    // diagonal rising
+    m = pos & (pos >> (BB_HEIGHT1 + 1));
+    if (m & (m >> (2 * (BB_HEIGHT1 + 1)))) return true;
+
+    // diagonal falling
+    m = pos & (pos >> (BB_HEIGHT1 - 1));
+    if (m & (m >> (2 * (BB_HEIGHT1 - 1)))) return true;
+
+    // vertical
+    m = pos & (pos >> 1);
+    if (m & (m >> 2)) return true;
+
+    return false;
+}
+
+/// @brief Returns the mask of the cells where a piece can be dropped.
+///
+/// Adding the bottom row to the occupancy mask carries into the first
+/// empty cell of every column; full columns carry into their sentinel
+/// row, which the board mask removes.
+///
+/// @param b Pointer to the board.
+///
+/// @return One bit per non-full column, set on the cell the next piece would land on.
+static inline uint64_t BitBoard_playable(const BitBoard_t *b)
+{
+    return (b->mask + BB_BOTTOM_MASK) & BB_BOARD_MASK;
+}
+
+/// @brief Checks whether a column still has room for a piece.
+static inline bool BitBoard_can_play(const BitBoard_t *b, Col_t col)
+{
+    return (b->mask & BB_TOP(col)) == 0;
+}
+
+/// @brief Drops a piece of the player to move in the given column.
+///
+/// @note The move is assumed to be legal, see BitBoard_can_play().
+static inline void BitBoard_play(BitBoard_t *b, Col_t col)
+{
+    b->position ^= b->mask;
+    b->mask |= b->mask + BB_BOTTOM(col);
+    b->moves++;
+}
+
+/// @brief Removes the highest piece of the given column.
+///
+/// The pieces of a column are contiguous from the bottom, so adding the
+/// bottom bit gives the first empty cell and shifting it down by one
+/// gives the highest piece.
+///
+/// @note The column must hold the piece that was played last.
+static inline void BitBoard_undo(BitBoard_t *b, Col_t col)
+{
+    uint64_t top = ((b->mask & BB_COLUMN_MASK(col)) + BB_BOTTOM(col)) >> 1;
+    b->mask ^= top;
+    b->position ^= b->mask;
+    b->moves--;
+}
+
+/// @brief Drops a piece of the player to move on a cell given as a bitboard.
+///
+/// Same as BitBoard_play() for callers that already hold the cell, e.g.
+/// one bit of BitBoard_playable().
+///
+/// @note The cell must be the lowest empty cell of its column.
+static inline void BitBoard_play_cell(BitBoard_t *b, uint64_t cell)
+{
+    b->position ^= b->mask;
+    b->mask |= cell;
+    b->moves++;
+}
+
+/// @brief Computes the empty cells that would complete a line of 4.
+///
+/// For every direction the pieces are shifted to find the runs of
+/// three, and the cell at either end of a run (or in the gap of a
+/// broken run like X.XX) is marked. Cells outside the board and cells
+/// already occupied are removed.
+///
+/// @param pos Bitboard of the pieces of a single player.
+/// @param mask Bitboard of all the occupied cells.
+///
+/// @return Bitboard of the empty cells where that player would win,
+///         whether or not they can be played right now.
+static inline uint64_t BitBoard_winning_cells(uint64_t pos, uint64_t mask)
+{
+    uint64_t r, p;
+
+    // vertical: the only possible cell is above three stacked pieces
+    r = (pos << 1) & (pos << 2) & (pos << 3);
+
+    // horizontal
+    p = (pos << BB_HEIGHT1) & (pos << 2 * BB_HEIGHT1);
+    r |= p & (pos << 3 * BB_HEIGHT1);
+    r |= p & (pos >> BB_HEIGHT1);
+    p = (pos >> BB_HEIGHT1) & (pos >> 2 * BB_HEIGHT1);
+    r |= p & (pos << BB_HEIGHT1);
+    r |= p & (pos >> 3 * BB_HEIGHT1);
+
+    // diagonal falling
+    p = (pos << (BB_HEIGHT1 - 1)) & (pos << 2 * (BB_HEIGHT1 - 1));
+    r |= p & (pos << 3 * (BB_HEIGHT1 - 1));
+    r |= p & (pos >> (BB_HEIGHT1 - 1));
+    p = (pos >> (BB_HEIGHT1 - 1)) & (pos >> 2 * (BB_HEIGHT1 - 1));
+    r |= p & (pos << (BB_HEIGHT1 - 1));
+    r |= p & (pos >> 3 * (BB_HEIGHT1 - 1));
+
+    // diagonal rising
+    p = (pos << (BB_HEIGHT1 + 1)) & (pos << 2 * (BB_HEIGHT1 + 1));
+    r |= p & (pos << 3 * (BB_HEIGHT1 + 1));
+    r |= p & (pos >> (BB_HEIGHT1 + 1));
+    p = (pos >> (BB_HEIGHT1 + 1)) & (pos >> 2 * (BB_HEIGHT1 + 1));
+    r |= p & (pos << (BB_HEIGHT1 + 1));
+    r |= p & (pos >> 3 * (BB_HEIGHT1 + 1));
+
+    return r & (BB_BOARD_MASK ^ mask);
+}
+
+/// @brief Counts the pieces (set bits) of a bitboard.
+static inline uint8_t BitBoard_count(uint64_t bits)
+{
+    uint8_t n = 0;
+    for (; bits; n++) bits &= bits - 1;
+    return n;
+}
+
+/// @brief Checks whether the player to move wins by playing the given column.
+///
+/// @note The column is assumed to be playable.
+static inline bool BitBoard_is_winning_move(const BitBoard_t *b, Col_t col)
+{
+    uint64_t pos = b->position | ((b->mask + BB_BOTTOM(col)) & BB_COLUMN_MASK(col));
+    return BitBoard_alignment(pos);
+}
+
+/// @brief Returns a key that identifies the position uniquely.
+///
+/// position + mask sets the bit above the highest piece of every column,
+/// which encodes the column heights next to the pieces of the player to move.
+static inline uint64_t BitBoard_key(const BitBoard_t *b)
+{
+    return b->position + b->mask;
+}
+
+/// @brief Initializes a bitboard to the empty starting position.
+///
+/// @param b Pointer to the bitboard to initialize.
+void BitBoard_init(BitBoard_t *b);
+
+/// @brief Builds the bitboard equivalent of an array board.
+///
+/// @param b Pointer to the bitboard to fill.
+/// @param board Pointer to the source array board.
+/// @param computer_to_move true  → the computer's pieces (p1) become position
+///                         false → the human's pieces (p2) become position
+void BitBoard_from_board(BitBoard_t *b, const Board_t *board, bool computer_to_move);
+
+/// @brief Builds the mirror image of a board, column c becoming column NUM_COLS - 1 - c.
+///
+/// A position and its mirror image have the same value, with mirrored
+/// best moves, so tables indexed by position only need to store one of them.
+///
+/// @param dst Pointer to the bitboard to fill.
+/// @param src Pointer to the bitboard to mirror, must be different from dst.
+void BitBoard_mirror(BitBoard_t *dst, const BitBoard_t *src);
+
+#endif /* INCLUDE_BITBOARD_H_ */
@@ -13,12 +13,22 @@
 #define INCLUDE_UTILS_H_
 
 
+/// @brief Windows of 4 cells that every cell belongs to.
+///
+/// CELL_WINDOWS[col][row][0] is the number of windows through the cell,
+/// followed by their indexes in Board_t.windows. Windows are numbered by
+/// direction (horizontal, vertical, diagonal rising, diagonal falling),
+/// then by column and row of their first cell.
+extern const uint8_t CELL_WINDOWS[NUM_COLS][NUM_ROWS][MAX_CELL_WINDOWS + 1];
+
 /// @brief Initializes a Connect 4 board to an empty starting state.
 /// 
 /// Resets all internal board data structures, including:
 /// - piece positions for both players
-/// - column heights
+/// - column heights and move count
 /// - accumulated heuristic score
+/// - zobrist hash (the empty board hashes to 0)
+/// - window counters
 ///
 /// This function must be called before starting a new game or
 /// before reusing a board structure.
@@ -30,8 +40,10 @@ void Board_init(Board_t * board);
 /// 
 /// Places a piece in the specified column and updates:
 /// - the player bitboard (computer or human)
-/// - the column height
+/// - the column height and the move count
 /// - the incremental heuristic score
+/// - the zobrist hash
+/// - the counters of the windows through the cell
 ///
 /// This function is used both for real gameplay and for simulated
 /// moves during Minimax search.
@@ -51,8 +63,10 @@ void Board_make_move(Board_t * board, Move_t move, bool is_computer, Score_t del
 /// Removes the most recent piece placed in the specified column and
 /// restores:
 /// - the player bitboard
-/// - the column height
+/// - the column height and the move count
 /// - the accumulated heuristic score
+/// - the zobrist hash
+/// - the counters of the windows through the cell
 ///
 /// This function enables efficient backtracking during Minimax search
 /// without copying the board.
@@ -44,7 +44,35 @@ extern Board_t game_board;
 ///
 /// Marked volatile because it may be modified at runtime,
 /// for example through user settings or hardware input.
-volatile uint8_t MAX_DEPTH;
+extern volatile uint8_t MAX_DEPTH;
+
+/// @brief Wall-clock budget of a search, in milliseconds.
+///
+/// fn_CALCULATING_MOVE() deepens the search one ply at a time until
+/// MAX_DEPTH is reached or this budget runs out, so the time taken by a
+/// move no longer depends on how many columns are open.
+/// Set by fn_INIT together with MAX_DEPTH, see the values below.
+extern volatile uint16_t SEARCH_BUDGET_MS;
+
+// time budget and depth limit of each difficulty
+// on hard the depth is limited by the time budget, the end of the game and the stack: every ply is a minimax() or
+// negamax() frame on the stack, README.md gives the stack size the CCS project needs for HARD_MAX_DEPTH.
+// the time budget usually stops the search earlier, except near the end of the game
+#define BUDGET_EASY_MS   250
+#define BUDGET_MEDIUM_MS 1000
+#define BUDGET_HARD_MS   3000
+#define HARD_MAX_DEPTH   24
+
+/// @brief Number of positions visited by the last search.
+///
+/// Incremented on every call of minimax() and reset at the start of
+/// each choose_move(). Debug builds (NDEBUG not defined) print
+/// it after every search together with the effective branching factor.
+/// Like the rest of the search state it is per thread on host builds.
+extern THREAD_LOCAL uint32_t search_nodes;
+
+/// @brief Depth of the last iteration completed by iterative_deepening().
+extern THREAD_LOCAL uint8_t search_depth;
 
 /// @brief Result of a Minimax search step.
 /// 
@@ -58,29 +86,74 @@ typedef struct {
     Score_t score;
 } Result_t;
 
-/// @brief Direction encoding for scanning board alignments.
-/// 
-/// Each value encodes a direction vector (dx, dy) used when
-/// evaluating potential 4-in-a-row windows.
+/// @brief Root search used by iterative_deepening() at every depth.
 ///
-/// Encoding format (1 byte):
-/// - high nibble  = dx (column step)
-/// - low nibble   = dy + 1 (row step offset to allow -1, 0, +1)
+/// - ALGORITHM_MINIMAX: minimax() with a full window (default)
+/// - ALGORITHM_PVS:     negamax() with principal variation search and
+///                      aspiration windows around the previous score
+/// - ALGORITHM_MTDF:    MTD(f) driver: null-window negamax() searches
+///                      converging on the score
 ///
-/// Directions included:
-/// - horizontal
-/// - vertical
-/// - diagonal rising
-/// - diagonal falling
-static const uint8_t DIRS[4] = {
-    0x11,  // dx=1, dy=0: horizontal
-    0x02,  // dx=0, dy=1: vertical  
-    0x12,  // dx=1, dy=1: up diagonal
-    0x10   // dx=1, dy=-1 down diagonal
-};
+/// The default can be changed with the SEARCH_ALGORITHM compiler define,
+/// host tools can also switch it at runtime through search_algorithm,
+/// separately in every thread.
+typedef enum {
+    ALGORITHM_MINIMAX,
+    ALGORITHM_PVS,
+    ALGORITHM_MTDF
+} Algorithm_t;
+
+#ifndef SEARCH_ALGORITHM
+#define SEARCH_ALGORITHM ALGORITHM_MINIMAX
+#endif
+
+/// @brief Root search currently used, initialized to SEARCH_ALGORITHM.
+extern THREAD_LOCAL Algorithm_t search_algorithm;
 
-#define GET_DX(dir) ((int8_t)((dir) >> 4))
-#define GET_DY(dir) ((int8_t)(((dir) & 0x0F) - 1))
+/// @brief Whether leaf positions are scored with threat_score() on top
+/// of the incremental window score.
+///
+/// Defaults to the EVAL_THREATS compiler define (on), host tools can
+/// turn it off at runtime to compare the two evaluations.
+#ifndef EVAL_THREATS
+#define EVAL_THREATS 1
+#endif
+extern THREAD_LOCAL bool eval_threats;
+
+/// @brief Weights of the static evaluation.
+///
+/// - WEIGHT_EMPTY:      empty window
+/// - WEIGHT_OWN_1/2:    window with 1 or 2 pieces of the player who moves
+/// - WEIGHT_ENEMY_1/2:  window with 1 or 2 pieces of the opponent
+/// - WEIGHT_ENEMY_3:    window where the move blocks 3 pieces of the opponent
+/// - WEIGHT_THREAT_*:   terms of threat_score()
+///
+/// A window with 3 own pieces is a win and always scores EVAL_WIN.
+/// The values are in include/evalweights.h, which the tuner
+/// host/tools/tune_eval.c can rewrite. They are constant on the MSP432,
+/// host tools can change them at runtime, separately in every thread.
+typedef enum {
+    WEIGHT_EMPTY,
+    WEIGHT_OWN_1,
+    WEIGHT_OWN_2,
+    WEIGHT_ENEMY_1,
+    WEIGHT_ENEMY_2,
+    WEIGHT_ENEMY_3,
+    WEIGHT_THREAT_GOOD,
+    WEIGHT_THREAT_WEAK,
+    WEIGHT_THREAT_IMMEDIATE,
+    WEIGHT_THREAT_FORCING,
+    NUM_EVAL_WEIGHTS
+} EvalWeight_t;
+
+#ifdef HOST_BUILD
+extern THREAD_LOCAL Score_t eval_weights[NUM_EVAL_WEIGHTS];
+#else
+extern const Score_t eval_weights[NUM_EVAL_WEIGHTS];
+#endif
+
+// value of eval_window() for a window the move completes, no weight may reach it
+#define EVAL_WIN 95
 
 /// @brief Evaluates a 4-cell window of the board and assigns a heuristic score.
 /// 
@@ -90,12 +163,12 @@ static const uint8_t DIRS[4] = {
 /// It returns a score indicating how favorable that window is for the
 /// specified player perspective.
 /// 
-/// Scoring principles:
+/// Scoring principles (see eval_weights):
 /// - Mixed window (both players present) → neutral (0)
 /// - Empty window -> small positional value
 /// - 1 or 2 pieces -> increasing score
 /// - 3 enemy pieces -> higher score
-/// - 3 my pieces → very high priority (win)
+/// - 3 my pieces → very high priority (win, EVAL_WIN)
 /// 
 /// @param p1 Number of computer pieces in the window.
 /// @param p2 Number of human player pieces in the window.
@@ -110,8 +183,8 @@ Score_t eval_window(uint8_t p1, uint8_t p2, bool player);
 /// 
 /// This function evaluates how the total board heuristic would change
 /// if a piece is placed at the specified column and row.
-/// It scans all directions (horizontal, vertical, diagonal) and evaluates
-/// every 4-cell window affected by the move.
+/// It evaluates every 4-cell window through the cell, listed in
+/// CELL_WINDOWS, from the piece counters kept in b->windows.
 /// 
 /// The function performs incremental evaluation, meaning it calculates
 /// only the score difference instead of recomputing the entire board.
@@ -131,6 +204,31 @@ Score_t eval_window(uint8_t p1, uint8_t p2, bool player);
 ///         May return SCORE_MAX or SCORE_MIN for immediate wins.
 Score_t delta_score(Board_t *b, Col_t col, int row, bool player);
 
+/// @brief Odd/even threat analysis of a position.
+///
+/// A threat is an empty cell that would complete a line of 4 for one
+/// side. They are computed for both sides with BitBoard_winning_cells()
+/// and scored by playability and row parity:
+/// - a threat above a threat of the other side in the same column is
+///   ignored, the lower one is filled first
+/// - a threat that can be played right now is a win next move for the
+///   side to move and a forced block for the other side
+/// - the other threats decide the endgame by zugzwang: when the columns
+///   fill up, the first player gets the cells on odd rows (1, 3, 5
+///   counting from the bottom) and the second player those on even
+///   rows, so threats on the right parity weigh much more
+///
+/// The incremental score only counts pieces in windows, this term lets a
+/// shallow search see endgames that are decided long before the board
+/// is full. It is not incremental: minimax() and negamax() add it to
+/// b->score at the leaves only.
+///
+/// @param b Pointer to the board to evaluate.
+/// @param maximizing true if the computer is to move, false for the human.
+///
+/// @return Score from the computer's point of view, like b->score.
+Score_t threat_score(const Board_t *b, bool maximizing);
+
 /// @brief Performs Minimax search with alpha–beta pruning to select the best move.
 /// 
 /// This recursive function explores possible future game states by simulating
@@ -145,6 +243,16 @@ Score_t delta_score(Board_t *b, Col_t col, int row, bool player);
 /// 
 /// Alpha–beta pruning is used to eliminate branches that cannot influence
 /// the final decision, improving efficiency and allowing deeper search.
+///
+/// Every searched position is stored in the transposition table with its
+/// score, bound type, depth and best move. When the same position is
+/// reached again through a different move order, a deep enough entry
+/// narrows the window or returns immediately.
+///
+/// The candidate columns are ranked by MoveOrder_sort() before being
+/// expanded: table move first, then killer moves, then history scores
+/// and the center-first order. Moves that cause a beta cutoff are fed
+/// back with MoveOrder_cutoff().
 /// 
 /// The recursion stops when:
 /// - the search depth reaches zero
@@ -163,17 +271,101 @@ Score_t delta_score(Board_t *b, Col_t col, int row, bool player);
 Result_t minimax(Board_t *b, int depth,
                  bool maximizing, Score_t alpha, Score_t beta);
 
+/// @brief Performs negamax search with principal variation search (PVS).
+///
+/// Same search as minimax(), written from the point of view of the side
+/// to move: a child's score is the negation of its own result, so both
+/// players share one code path and the window is (alpha, beta) for the
+/// side to move.
+///
+/// The first move of a node, the best one according to the move
+/// ordering, is searched with the full window. Every other move is
+/// searched with a null window (alpha, alpha + 1), which only proves
+/// that it is not better than alpha; if it fails high it is searched
+/// again with the full window.
+///
+/// Transposition table entries are shared with minimax(): they are
+/// stored from the computer's point of view and converted on access.
+///
+/// @param b Pointer to the current board state.
+/// @param depth Remaining search depth.
+/// @param maximizing true if computer turn, false if human turn.
+/// @param alpha Score the side to move can already guarantee.
+/// @param beta  Score the opponent can already guarantee, negated.
+///
+/// @return Best move and its score from the side to move's point of
+///         view: SCORE_MAX for a win, -SCORE_MAX for a loss.
+Result_t negamax(Board_t *b, int depth,
+                 bool maximizing, Score_t alpha, Score_t beta);
+
+/// @brief Searches a position with time-budgeted iterative deepening.
+///
+/// Runs the root search selected by search_algorithm with depth 1, 2,
+/// 3, ... up to max_depth. Every
+/// iteration starts by following the principal variation of the previous
+/// one, and the transposition table and move ordering tables it filled,
+/// so the deeper iteration mostly costs the new ply.
+///
+/// The clock is polled every few thousand nodes. If the budget expires
+/// in the middle of an iteration, that iteration is abandoned and the
+/// move of the last completed one is returned. The first iteration is
+/// always completed, so a legal move is returned even with a zero budget.
+///
+/// The search also stops early when a forced win or loss is found.
+///
+/// @param b Pointer to the board to search, it is restored on return.
+/// @param maximizing true if the computer is to move, false for the human.
+/// @param max_depth Deepest iteration to run.
+/// @param budget_ms Wall-clock budget in milliseconds.
+///
+/// @return Best move and score of the last completed iteration, from
+///         the computer's point of view like minimax(), whose depth is
+///         stored in search_depth.
+Result_t iterative_deepening(Board_t *b, bool maximizing, int max_depth, uint32_t budget_ms);
+
+/// @brief Settings of a search stopped from outside: the helper threads
+/// of the parallel search on host builds (host/source/lazysmp.c) and
+/// pondering (source/ponder.c).
+///
+/// They are per thread. When search_stop is not NULL
+/// iterative_deepening() starts at search_first_depth instead of 1,
+/// does not start a new transposition table generation (the caller does
+/// it once for all its searches), and abandons the search as soon as
+/// *search_stop becomes true, even during its first iteration.
+extern THREAD_LOCAL const volatile bool *search_stop;
+extern THREAD_LOCAL uint8_t search_first_depth;
+
+/// @brief Chooses the move of a player in any position.
+///
+/// Decision steps:
+/// - Plays any immediate winning move (1-ply search)
+/// - Plays the opening book move if the position is in the book
+/// - Plays the move found by pondering if the position was pondered to
+///   the end (computer to move only, see include/ponder.h)
+/// - Otherwise runs iterative_deepening() with the given limits,
+///   reusing the transposition table entries of the previous turns
+///
+/// It only works on the board it is given and on the search state,
+/// which is per thread on host builds, so host tools can play several
+/// games at the same time. search_nodes and search_depth describe the
+/// search afterwards, both are 0 when no search was needed.
+///
+/// @param b Pointer to the board, it is restored on return.
+/// @param maximizing true if the computer is to move, false for the human.
+/// @param max_depth Deepest iteration of the search.
+/// @param budget_ms Wall-clock budget of the search in milliseconds.
+///
+/// @return Column to play.
+Col_t choose_move(Board_t *b, bool maximizing, int max_depth, uint32_t budget_ms);
+
 /// @brief Determines and registers the computer's next move.
 /// 
 /// This function is the main entry point for the AI decision process.
-/// It evaluates the current game board and selects the best column
-/// for the computer to play.
 ///
 /// Execution steps:
 /// - Displays a waiting indicator
-/// - Checks for any immediate winning move (1-ply search)
-/// - If no immediate win exists, runs the Minimax algorithm
-///   with alpha–beta pruning to evaluate future game states
+/// - Selects the computer's column on game_board with choose_move(),
+///   with MAX_DEPTH and the time budget of the difficulty (SEARCH_BUDGET_MS)
 /// - Stores the selected move in the global variable move_to_make
 /// - Signals the system to execute the move
 ///
@@ -190,8 +382,9 @@ void fn_CALCULATING_MOVE(void);
 /// - draw (board full)
 /// - ongoing game
 ///
-/// The decision is based on score thresholds that represent a winning
-/// alignment and whether the board is completely filled.
+/// The decision is based on the SCORE_MAX and SCORE_MIN values that
+/// delta_score() returns for a winning alignment and whether the board
+/// is completely filled.
 ///
 /// @param delta Score change produced by the most recent move.
 /// 
@@ -1,4 +1,5 @@
 #include "types.h"
+#include "statusbitmaps.h"
 
 #ifndef DISPLAYCONTROLLER_DISPLAYCONTROLLER_H_
 #define DISPLAYCONTROLLER_DISPLAYCONTROLLER_H_
@@ -24,5 +25,17 @@ void Display_clear(void);
 // char *text: text to display
 void Display_printCentered(char *text);
 
+// function to write a message on the status line above the board, without clearing the rest of the display
+// StatusMessage_t message: message to display, see include/statusbitmaps.h
+// Col_t column: column whose number follows the message, NUM_COLS for none
+void Display_status(StatusMessage_t message, Col_t column);
+
+// function that brings the board on the display up to date with game_board, drawing only the discs added since the
+// last call (the whole board after Display_clear(), Display_printCentered() or a new game)
+void Display_board(void);
+
+// function that marks the column col above the board, NUM_COLS removes the mark
+void Display_highlight(Col_t col);
+
 
 #endif /* DISPLAYCONTROLLER_DISPLAYCONTROLLER_H_ */
@@ -0,0 +1,29 @@
+/*
+ * evalweights.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* weights of the static evaluation, in EvalWeight_t order (see include/connect4algorithm.h)
+ * hand-written values of the original evaluation: the weights fitted by tune_eval so far predict game results better
+ * but choose the solver's best move less often at shallow depths, so they are not used.
+ * `tune_eval fit` (host/tools/tune_eval.c) prints a replacement for this file with the weights it fits
+ */
+
+#ifndef INCLUDE_EVALWEIGHTS_H_
+#define INCLUDE_EVALWEIGHTS_H_
+
+#define EVAL_WEIGHTS { \
+    1,    /* WEIGHT_EMPTY */ \
+    2,    /* WEIGHT_OWN_1 */ \
+    4,    /* WEIGHT_OWN_2 */ \
+    1,    /* WEIGHT_ENEMY_1 */ \
+    2,    /* WEIGHT_ENEMY_2 */ \
+    5,    /* WEIGHT_ENEMY_3 */ \
+    16,   /* WEIGHT_THREAT_GOOD */ \
+    4,    /* WEIGHT_THREAT_WEAK */ \
+    48,   /* WEIGHT_THREAT_IMMEDIATE */ \
+    4,    /* WEIGHT_THREAT_FORCING */ \
+}
+
+#endif /* INCLUDE_EVALWEIGHTS_H_ */
@@ -0,0 +1,154 @@
+/*
+ * hal.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_HAL_H_
+#define INCLUDE_HAL_H_
+
+
+/* hardware abstraction layer: everything the firmware needs from the hardware goes through these functions
+ *
+ * the interface has two implementations:
+ * - source/hal_msp432.c: the MSP432 with TI DriverLib, it also contains the port interrupt service routines
+ * - host/source/hal_host.c (HOST_BUILD defined): a Linux process that reads the sensor and button events from a script
+ *   on stdin and records the display output on stdout, so that the real fsm[] loop of main.c runs on a PC
+ *
+ * inputs are the column sensors and the BoosterPack buttons. they are active low with a pull-up and raise an
+ * interrupt on the falling edge, the interrupt calls the handler registered for the input with HAL_input_set_handler()
+ */
+
+// inputs of the board: one sensor per column, in column order, then the two BoosterPack buttons
+typedef enum {
+    HAL_INPUT_SENSOR1,
+    HAL_INPUT_SENSOR2,
+    HAL_INPUT_SENSOR3,
+    HAL_INPUT_SENSOR4,
+    HAL_INPUT_SENSOR5,
+    HAL_INPUT_SENSOR6,
+    HAL_INPUT_SENSOR7,
+    HAL_INPUT_BUTTON1,
+    HAL_INPUT_BUTTON2,
+    HAL_NUM_INPUTS
+} HAL_Input_t;
+
+// sensor on top of a column, Col_t c
+#define HAL_INPUT_SENSOR(c) ((HAL_Input_t)(HAL_INPUT_SENSOR1 + (c)))
+
+// function called in interrupt context when an enabled input triggers
+typedef void (*HAL_InputHandler_t)(HAL_Input_t input);
+
+// function called in interrupt context when an asynchronous SPI transfer has been sent completely
+typedef void (*HAL_SpiDoneHandler_t)(void);
+
+// control lines of the LCD, besides the SPI clock and data
+typedef enum {
+    HAL_LCD_PIN_RST,    // reset, active low
+    HAL_LCD_PIN_DC,     // low: command, high: data
+    HAL_LCD_PIN_CS      // chip select, active low
+} HAL_LcdPin_t;
+
+
+// function that prepares the hardware: stops the watchdog, starts the timer and enables the interrupts of the input ports
+// must be called once at startup, before any other HAL_ function
+void HAL_init(void);
+
+
+// function that configures an input as a pull-up input that triggers on the falling edge, with its interrupt disabled
+void HAL_input_init(HAL_Input_t input);
+
+// function that registers the function called when an input triggers, NULL to ignore the input
+void HAL_input_set_handler(HAL_Input_t input, HAL_InputHandler_t handler);
+
+// function that clears the pending interrupt of an input and enables it
+void HAL_input_enable(HAL_Input_t input);
+
+// function that disables the interrupt of an input
+void HAL_input_disable(HAL_Input_t input);
+
+
+// function that puts the processor to sleep until an interrupt wakes it up
+// any interrupt ends the sleep, not only the inputs: also the end of every SPI DMA transfer, e.g. while a flush of the
+// LCD framebuffer goes on after it returned. callers that wait for an event use HAL_sleep_until() instead
+void HAL_sleep(void);
+
+// function that sleeps until *flag is true, and does not sleep if it already is: the flag is set by an interrupt
+// handler, and is checked with the interrupts disabled so that an interrupt between the check and the sleep still
+// wakes it up. the other interrupts only end one sleep, the flag is checked again after each of them
+void HAL_sleep_until(const volatile bool *flag);
+
+// function that returns the most stack used since HAL_init() in bytes, 0 where it is not measured (the host).
+// HAL_init() fills the free part of the stack with a pattern, the peak is the deepest word that no longer holds it
+uint32_t HAL_stack_peak(void);
+
+// function that returns true if HAL_sleep() would return without waiting, i.e. the next input is already there.
+// never on the MSP432, whose handlers run as soon as an input triggers. always on the host, whose HAL_sleep() reads
+// the next event of the script at once: its handler cannot run earlier, so a search waiting for it would never stop
+bool HAL_input_pending(void);
+
+// functions that busy-wait for at least the given time
+void HAL_delay_us(uint32_t us);
+void HAL_delay_ms(uint32_t ms);
+
+
+// function that starts the free-running counter used by timer.c
+void HAL_timer_init(void);
+
+// function that returns the counter, it counts up and wraps around
+uint32_t HAL_timer_now(void);
+
+// function that returns the number of counter ticks in a millisecond
+uint32_t HAL_timer_ticks_per_ms(void);
+
+
+// function that connects the SPI clock and data pins to the SPI module and makes the LCD control lines outputs
+void HAL_lcd_port_init(void);
+
+// function that starts the SPI master that drives the LCD, selects the LCD and puts it in data mode
+void HAL_spi_init(void);
+
+// function that sends a byte on the SPI bus and waits for the transmission to end
+// it waits for the asynchronous transfer in progress first, so the bytes go out in the order they were given
+void HAL_spi_write(uint8_t data);
+
+// functions that send 16-bit pixels on the SPI bus, high byte first, and wait for the transmission to end
+// HAL_spi_write_pixels() sends count pixels of a buffer, HAL_spi_fill() sends the same pixel count times.
+// the bytes follow each other without waiting for the bus to be idle in between, and the asynchronous transfer in
+// progress is waited for first
+void HAL_spi_write_pixels(const uint16_t *pixels, uint32_t count);
+void HAL_spi_fill(uint16_t pixel, uint32_t count);
+
+// function that starts sending a buffer on the SPI bus and returns at once, the DMA sends it while the CPU goes on
+// the buffer must not change until the transfer is done. done, if not NULL, is called in interrupt context once the
+// last byte has left the bus, never before HAL_spi_write_async() returns; it may start the next transfer.
+// only one transfer can be in progress, length is at least 1
+void HAL_spi_write_async(const uint8_t *data, uint16_t length, HAL_SpiDoneHandler_t done);
+
+// function that waits until no asynchronous transfer is in progress, including the ones started by done handlers
+void HAL_spi_wait(void);
+
+// function that sets an LCD control line high or low, after the asynchronous transfer in progress
+void HAL_lcd_set_pin(HAL_LcdPin_t pin, bool high);
+
+
+// function that opens the telemetry sink of the search statistics (include/searchstats.h): the UART of the XDS110
+// backchannel on the MSP432, the file or pipe named by the CONNECT4_TELEMETRY environment variable on the host
+void HAL_telemetry_init(void);
+
+// function that sends a buffer to the telemetry sink and waits for it to be sent, it does nothing if there is no sink
+void HAL_telemetry_write(const uint8_t *data, uint16_t length);
+
+
+#ifdef HOST_BUILD
+// host backend only: the display controller records the text it draws with this function. the LCD driver and the
+// graphics library only run on the host when the firmware is built with HOST_LCD, the function then also reports the
+// LCD traffic of the screen (see host/source/hal_host.c)
+void HAL_host_display(const char *text);
+#endif
+
+#endif /* INCLUDE_HAL_H_ */
@@ -0,0 +1,70 @@
+/*
+ * moveorder.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_MOVEORDER_H_
+#define INCLUDE_MOVEORDER_H_
+
+
+/* move ordering used by minimax() to search the most promising columns first, which gives earlier alpha-beta cutoffs
+ *
+ * the candidate columns of a node are ranked as follows:
+ * - the move of the previous iteration's principal variation, while the search is following it
+ * - the best move stored in the transposition table for the position
+ * - the killer moves of the ply: the last two moves that caused a cutoff at the same ply in a sibling subtree
+ * - every other column by history score: how much the move caused cutoffs anywhere in the tree, for that player
+ *   and that cell, ties broken by the static center-first order 4 3 5 2 6 1 7 (central columns belong to more lines of 4)
+ *
+ * killers are indexed by the ply of the game (Board_t.moves), so they stay meaningful when the search starts from a
+ * different position. they are cleared at the start of every search, while history scores are only halved
+ */
+
+// number of plies of a complete game, plies are indexed from 0 to MAX_PLY - 1
+#define MAX_PLY (NUM_COLS * NUM_ROWS)
+
+// number of killer moves remembered per ply
+#define NUM_KILLERS 2
+
+
+/// @brief Prepares the ordering tables for a new search.
+///
+/// Clears the killer moves and halves the history scores, so that what
+/// was learned in the previous turns still counts but fades away.
+void MoveOrder_new_search(void);
+
+/// @brief Empties the ordering tables completely.
+///
+/// Called when a new game starts.
+void MoveOrder_clear(void);
+
+/// @brief Lists the legal moves of a position, best candidates first.
+///
+/// @param b Pointer to the current board state.
+/// @param maximizing true if the computer is to move, false for the human.
+/// @param pv_move Move of the previous principal variation at this node, or TT_NO_MOVE.
+/// @param tt_move Best move from the transposition table, or TT_NO_MOVE.
+/// @param moves Output: legal columns in the order they should be searched.
+///
+/// @return Number of legal moves written to moves.
+uint8_t MoveOrder_sort(const Board_t *b, bool maximizing, Move_t pv_move, Move_t tt_move, Move_t moves[NUM_COLS]);
+
+/// @brief Records a move that caused a beta cutoff.
+///
+/// The move becomes the first killer of the ply and its history score
+/// grows with the square of the remaining depth, so that cutoffs close
+/// to the root weigh more than cutoffs near the leaves.
+///
+/// @param b Pointer to the board, before the move is made.
+/// @param maximizing true if the computer is to move, false for the human.
+/// @param move Column that caused the cutoff.
+/// @param depth Remaining depth of the node where the cutoff happened.
+void MoveOrder_cutoff(const Board_t *b, bool maximizing, Move_t move, int depth);
+
+#endif /* INCLUDE_MOVEORDER_H_ */
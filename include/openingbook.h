@@ -0,0 +1,73 @@
+/*
+ * openingbook.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_OPENINGBOOK_H_
+#define INCLUDE_OPENINGBOOK_H_
+
+
+/* opening book consulted by choose_move() before searching
+ *
+ * the book holds the best move of every position the computer can be asked to play in the first BOOK_PLIES plies,
+ * assuming it followed the book itself, for both the games it starts and the games the player starts.
+ * the moves are computed offline by the exact solver (host/tools/gen_book.c) and stored in flash as constant tables
+ * generated in source/bookdata.c.
+ *
+ * a position and its mirror image share one entry: positions are identified by the smaller of the two BitBoard_key()
+ * values and the move is mirrored back when the key came from the mirror image.
+ *
+ * positions are found in constant time with a perfect hash (hash and displace):
+ * - the key is hashed with seed 0 to pick a bucket and the check bits
+ * - every bucket has a displacement, chosen by the generator, that is the seed of a second hash picking the slot
+ * the displacements are chosen so that no two positions of the book share a slot. a slot holds the check bits of its
+ * position and its move, so positions that are not in the book are rejected (up to a 1 in 2^13 chance of a false hit)
+ */
+
+// a slot of the table: check bits in bits 3-15, move in bits 0-2
+typedef uint16_t BookEntry_t;
+
+#define BOOK_ENTRY_MOVE(e)  ((Move_t)((e) & 0x07))
+#define BOOK_ENTRY_CHECK(e) ((uint16_t)((e) >> 3))
+#define BOOK_ENTRY(check, move) ((BookEntry_t)(((check) << 3) | ((move) & 0x07)))
+
+// check bits of a hash, and the value of the empty slots (no position has move 7)
+#define BOOK_CHECK(h) ((uint16_t)((h) >> 19))
+#define BOOK_EMPTY_SLOT ((BookEntry_t)0x0007)
+
+
+// generated tables, see source/bookdata.c
+extern const uint8_t BOOK_PLIES;
+extern const uint16_t BOOK_NUM_BUCKETS;
+extern const uint16_t BOOK_NUM_SLOTS;
+extern const uint8_t book_displacements[];
+extern const BookEntry_t book_slots[];
+
+
+/// @brief Hash function of the book, shared by the lookup and the generator.
+///
+/// @param key Canonical key of the position.
+/// @param seed 0 for the bucket and check bits, the bucket's
+///             displacement + 1 for the slot.
+///
+/// @return 32-bit hash.
+uint32_t Book_hash(uint64_t key, uint32_t seed);
+
+/// @brief Looks a position up in the opening book.
+///
+/// @param board Position to look up.
+/// @param maximizing true if the computer (p1) is to move, false for the
+///        human. The book only depends on the pieces of the side to move
+///        and of its opponent, so it serves both sides.
+/// @param move Output: column to play if the position is in the book.
+///
+/// @return true if the position was found in the book.
+bool Book_lookup(const Board_t *board, bool maximizing, Move_t *move);
+
+#endif /* INCLUDE_OPENINGBOOK_H_ */
@@ -0,0 +1,59 @@
+/*
+ * ponder.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_PONDER_H_
+#define INCLUDE_PONDER_H_
+
+
+/* pondering: searching while the human thinks about their move
+ *
+ * fn_WAITING_FOR_MOVE() used to sleep until a sensor detected the human's move. it now calls Ponder_run() first,
+ * which plays every reply of the human on the board and searches the position after it like fn_CALCULATING_MOVE()
+ * would: same depth limit, same time budget for each reply. the replies are deepened together one iteration at a time,
+ * most likely first, so that a quick human still finds every reply searched to some depth. the sensor interrupt stops
+ * the search at once through search_stop (include/connect4algorithm.h). the host backend runs the handlers only when
+ * the firmware sleeps, nothing could stop the search there, so fn_WAITING_FOR_MOVE() skips pondering when
+ * HAL_input_pending() reports that the move is already there.
+ *
+ * when the human's move arrives, choose_move() asks Ponder_lookup() for the position:
+ * - if its search ended before the interrupt, the move is played without searching again
+ * - otherwise the search starts over, but the transposition table already holds what pondering found
+ * the likely reply is the best move of the human stored in the transposition table by the last search, the others
+ * follow in the usual move order. replies that win for the human, fill the board or lead to a book position are
+ * skipped, there is nothing to search there
+ */
+
+
+// function that forgets the pondered positions, called at the start of a game
+void Ponder_clear(void);
+
+/// @brief Searches the replies of the human while waiting for their move.
+///
+/// Returns when every reply has been searched or as soon as *stop becomes
+/// true, whichever comes first. Each round runs one more iteration of
+/// every reply that has not ended yet, so the whole run takes up to
+/// budget_ms times the number of replies.
+///
+/// @param b Pointer to the board, the human is to move. It is restored on return.
+/// @param max_depth Deepest iteration of each search.
+/// @param budget_ms Wall-clock budget of each reply in milliseconds, summed over the rounds.
+/// @param stop Flag set by the interrupt that detects the human's move.
+void Ponder_run(Board_t *b, int max_depth, uint32_t budget_ms, const volatile bool *stop);
+
+/// @brief Looks up the move found by pondering for a position.
+///
+/// @param b Position, the computer is to move.
+/// @param move Output: column to play if the position was pondered to the end.
+///
+/// @return true if the search of the position ended before it was stopped.
+bool Ponder_lookup(const Board_t *b, Move_t *move);
+
+#endif /* INCLUDE_PONDER_H_ */
@@ -0,0 +1,154 @@
+/*
+ * searchstats.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "include/timer.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_SEARCHSTATS_H_
+#define INCLUDE_SEARCHSTATS_H_
+
+
+/* statistics of the search, for finding out where the time of a move goes
+ *
+ * the counters are compiled in only when SEARCH_STATS is defined to 1 in the compiler options. otherwise every STATS_
+ * macro below expands to nothing and the search is the same code as without them.
+ *
+ * the counters are reset by choose_move() and, after every fn_CALCULATING_MOVE(), sent as one binary record through
+ * the telemetry sink of the HAL (HAL_telemetry_write()): the UART of the XDS110 backchannel on the MSP432, the file
+ * named by the CONNECT4_TELEMETRY environment variable on the host. host/tools/decode_stats.c prints the records.
+ *
+ * a record is STATS_RECORD_SIZE bytes, multi-byte fields are little endian:
+ *     0   sync byte STATS_SYNC
+ *     1   format version STATS_VERSION
+ *     2   payload length STATS_PAYLOAD_SIZE
+ *     3   payload:
+ *         +0   ply of the game before the move (pieces on the board)
+ *         +1   column chosen, 0 to 6
+ *         +2   how it was chosen, see StatsShortcut_t
+ *         +3   depth of the last completed iteration
+ *         +4   deepest ply reached below the root
+ *         +5   nodes (u32)
+ *         +9   leaf evaluations (u32)
+ *         +13  total time in microseconds (u32)
+ *         +17  beta cutoffs by index of the move in the ordered list of its node, 7 x u32
+ *         +45  time spent below each root move in microseconds, by column, 7 x u32
+ *     76  Fletcher-16 checksum of the payload (u16)
+ */
+
+#ifndef SEARCH_STATS
+#define SEARCH_STATS 0
+#endif
+
+#define STATS_SYNC 0xC4
+#define STATS_VERSION 1
+#define STATS_PAYLOAD_SIZE 73
+#define STATS_RECORD_SIZE (3 + STATS_PAYLOAD_SIZE + 2)
+
+// how choose_move() found its move
+typedef enum {
+    STATS_SEARCHED,         // by iterative_deepening()
+    STATS_IMMEDIATE_WIN,    // a move that wins at once, without searching
+    STATS_BOOK,             // from the opening book
+    STATS_PONDER            // searched while the human was thinking, see include/ponder.h
+} StatsShortcut_t;
+
+/* struct type of the counters of a move
+ *  leaves:       positions scored by the static evaluation
+ *  cutoffs:      beta cutoffs by index of the move that caused them, 0 is the first move searched
+ *  max_ply:      deepest ply below the root reached by the search
+ *  shortcut:     how the move was chosen, see StatsShortcut_t
+ *  start:        time choose_move() started
+ *  root_start:   time the root move being searched started
+ *  root_ticks:   time spent below each root move, in timer ticks, by column, summed over the iterations
+ * the nodes and the depth are the ones of search_nodes and search_depth
+ */
+typedef struct {
+    uint32_t leaves;
+    uint32_t cutoffs[NUM_COLS];
+    uint8_t max_ply;
+    uint8_t shortcut;
+    Ticks_t start;
+    Ticks_t root_start;
+    uint32_t root_ticks[NUM_COLS];
+} SearchStats_t;
+
+
+/* struct type of a record, decoded
+ * the fields are the ones of the payload described above, the times are in microseconds
+ */
+typedef struct {
+    uint8_t ply;
+    Col_t move;
+    uint8_t shortcut;
+    uint8_t depth;
+    uint8_t max_ply;
+    uint32_t nodes;
+    uint32_t leaves;
+    uint32_t total_us;
+    uint32_t cutoffs[NUM_COLS];
+    uint32_t root_us[NUM_COLS];
+} StatsRecord_t;
+
+
+// the functions below are compiled without SEARCH_STATS too, so that host/tools/decode_stats.c can link them
+
+/// @brief Computes the Fletcher-16 checksum of a buffer.
+uint16_t Stats_checksum(const uint8_t *data, uint16_t length);
+
+/// @brief Encodes a record.
+///
+/// @param out Output: the STATS_RECORD_SIZE bytes of the record.
+/// @param record Record to encode.
+void Stats_encode(uint8_t out[STATS_RECORD_SIZE], const StatsRecord_t *record);
+
+/// @brief Decodes a record.
+///
+/// @param in The STATS_RECORD_SIZE bytes of the record.
+/// @param record Output: the decoded record.
+/// @return false if the header is not the one of this version or the checksum is wrong.
+bool Stats_decode(const uint8_t in[STATS_RECORD_SIZE], StatsRecord_t *record);
+
+#if SEARCH_STATS
+
+// counters of the move being chosen, per thread on host builds
+extern THREAD_LOCAL SearchStats_t search_stats;
+
+/// @brief Empties the counters and starts the clock of a move.
+void Stats_reset(void);
+
+/// @brief Sends the record of the move just chosen to the telemetry sink.
+///
+/// @param ply Pieces on the board before the move.
+/// @param move Column chosen.
+void Stats_emit(uint8_t ply, Col_t move);
+
+#define STATS_RESET()           Stats_reset()
+#define STATS_EMIT(ply, move)   Stats_emit((ply), (move))
+#define STATS_LEAF()            (search_stats.leaves++)
+#define STATS_CUTOFF(index)     (search_stats.cutoffs[(index)]++)
+#define STATS_PLY(ply)          do { if ((ply) > search_stats.max_ply) search_stats.max_ply = (ply); } while (0)
+#define STATS_SHORTCUT(kind)    (search_stats.shortcut = (kind))
+#define STATS_ROOT_BEGIN(ply)   do { if ((ply) == 0) search_stats.root_start = Timer_now(); } while (0)
+#define STATS_ROOT_END(ply, c)  do { if ((ply) == 0) search_stats.root_ticks[(c)] += Timer_now() - \
+                                                                                 search_stats.root_start; } while (0)
+
+#else
+
+#define STATS_RESET()           ((void)0)
+#define STATS_EMIT(ply, move)   ((void)0)
+#define STATS_LEAF()            ((void)0)
+#define STATS_CUTOFF(index)     ((void)0)
+#define STATS_PLY(ply)          ((void)0)
+#define STATS_SHORTCUT(kind)    ((void)0)
+#define STATS_ROOT_BEGIN(ply)   ((void)0)
+#define STATS_ROOT_END(ply, c)  ((void)0)
+
+#endif
+
+#endif /* INCLUDE_SEARCHSTATS_H_ */
@@ -6,6 +6,7 @@
  */
 
 #include "include/types.h"
+#include "include/hal.h"
 
 
 #ifndef SENSORSDRIVER_SENSORSDRIVER_H_
@@ -17,6 +18,7 @@ extern Board_t game_board;
 
 
 /* function that prepares the sensors at the top of the columns and waits for them to detect the human players move
+ * while waiting it searches the likely replies of the computer (see include/ponder.h), then sleeps
  * the sensors will trigger an interrupt that will update the data structure that holds the current state of the game
  * board will then return control to main
  */
@@ -32,7 +34,8 @@ void Sensors_init(void);
 void Sensors_request_piece(Col_t column);
 
 // function that processes an interrupt caused by a sensor
-// called by an ISR after it has determined the interrupt comes from a sensor
-void Sensors_process_interrupt(uint_fast8_t port);
+// registered by Sensors_init() as the HAL handler of every sensor input
+// HAL_Input_t input:   sensor that triggered
+void Sensors_process_interrupt(HAL_Input_t input);
 
 #endif /* SENSORSDRIVER_SENSORSDRIVER_H_ */
@@ -0,0 +1,80 @@
+/*
+ * stateprofile.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_STATEPROFILE_H_
+#define INCLUDE_STATEPROFILE_H_
+
+
+/* latency profile of the states of fsm[]
+ *
+ * main() timestamps every call of a state function with the timer of timer.h (Timer32 on the MSP432, the monotonic
+ * clock on the host) and adds its duration to the histogram of the state and of the difficulty chosen in the start
+ * menu. the histograms have logarithmic buckets: bucket 0 counts the calls shorter than 2 us, bucket k the calls from
+ * 2^k us up to 2^(k+1) us, the last bucket everything longer.
+ *
+ * a call lasts until the state function returns, so the states that sleep include the time spent waiting for the
+ * player: fn_WAITING_FOR_MOVE covers the player's move and the two seconds the move stays on the display,
+ * fn_CALCULATING_MOVE covers the search and the display refresh.
+ *
+ * the report is sent on demand: a button pressed on the game over screen writes it to the telemetry sink of the HAL
+ * (HAL_telemetry_write()), host programs can also read the histograms with Profile_get()
+ */
+
+#define PROFILE_NUM_BUCKETS 32
+
+// difficulty levels of the start menu, the histograms are kept per level
+typedef enum {
+    PROFILE_LEVEL_EASY,
+    PROFILE_LEVEL_MEDIUM,
+    PROFILE_LEVEL_HARD,
+    PROFILE_NUM_LEVELS
+} ProfileLevel_t;
+
+/* struct type of the histogram of a state at a level
+ *  count:    calls of the state function
+ *  total_us: sum of their durations in microseconds
+ *  max_us:   longest call
+ *  buckets:  calls by bucket of their duration, see above
+ */
+typedef struct {
+    uint32_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint32_t buckets[PROFILE_NUM_BUCKETS];
+} ProfileHistogram_t;
+
+// function that writes a piece of the report, e.g. to the telemetry sink
+typedef void (*ProfileWriter_t)(const char *text);
+
+
+// function that empties all the histograms
+void Profile_clear(void);
+
+// function that selects the level the next calls are counted in, set by fn_INIT once the difficulty is chosen
+void Profile_set_level(ProfileLevel_t level);
+
+// functions called by main() around every call of a state function
+// the duration is counted at the level selected when the state function returns
+void Profile_enter(State_t state);
+void Profile_exit(State_t state);
+
+// function that returns the bucket of a duration in microseconds
+uint8_t Profile_bucket(uint32_t us);
+
+// function that returns the histogram of a state at a level
+const ProfileHistogram_t *Profile_get(State_t state, ProfileLevel_t level);
+
+// function that writes the report of all the histograms that are not empty, as lines of text:
+//     <state> <level>: <count> calls, mean <us> us, max <us> us
+//       <lower bound of the bucket> us: <count>    for every bucket that is not empty
+void Profile_report(ProfileWriter_t write);
+
+#endif /* INCLUDE_STATEPROFILE_H_ */
@@ -0,0 +1,58 @@
+/*
+ * statusbitmaps.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+
+
+#ifndef INCLUDE_STATUSBITMAPS_H_
+#define INCLUDE_STATUSBITMAPS_H_
+
+
+/* messages of the status line above the board, rendered offline
+ *
+ * the messages never change, so instead of drawing them glyph by glyph with the graphics library they are rendered
+ * by host/tools/gen_status.c in the 6x8 cells of g_sFontFixed6x8 and stored in flash as constant 1-bpp bitmaps,
+ * generated in source/statusdata.c. a bitmap is STATUS_BITMAP_HEIGHT rows from the top, every row is
+ * STATUS_ROW_BYTES(width) bytes with the leftmost pixel in the most significant bit; a set bit is a pixel of a letter.
+ *
+ * the messages that end with a column number are stored without it, the number is drawn after them with the bitmap
+ * of its digit
+ */
+
+#define STATUS_BITMAP_HEIGHT    8
+#define STATUS_ROW_BYTES(width) (((width) + 7) / 8)
+
+// messages of the status line
+typedef enum {
+    STATUS_YOUR_MOVE,       // "Your move: Yellow"
+    STATUS_CALCULATING,     // "Calculating Move"
+    STATUS_RED_MOVES_TO,    // "Red moves to: " and the column
+    STATUS_YOU_CHOSE,       // "You chose: " and the column
+    STATUS_YOU_WON,         // "You WON! :D"
+    STATUS_YOU_LOST,        // "You Lost :("
+    STATUS_DRAW,            // "Draw"
+    NUM_STATUS_MESSAGES
+} StatusMessage_t;
+
+/* struct type of a bitmap
+ *  width: width in pixels
+ *  bits:  STATUS_BITMAP_HEIGHT rows of STATUS_ROW_BYTES(width) bytes
+ */
+typedef struct {
+    uint8_t width;
+    const uint8_t *bits;
+} StatusBitmap_t;
+
+
+// generated tables, see source/statusdata.c
+// the text of every message, for the host and the generator, and the bitmaps of the messages and of the numbers of
+// the columns, 1 to NUM_COLS
+extern const char *const STATUS_TEXTS[NUM_STATUS_MESSAGES];
+extern const StatusBitmap_t STATUS_MESSAGES[NUM_STATUS_MESSAGES];
+extern const StatusBitmap_t STATUS_DIGITS[NUM_COLS];
+
+#endif /* INCLUDE_STATUSBITMAPS_H_ */
@@ -0,0 +1,42 @@
+/*
+ * timer.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "stdint.h"
+
+
+#ifndef INCLUDE_TIMER_H_
+#define INCLUDE_TIMER_H_
+
+
+/* monotonic time source used to enforce the time budget of the search
+ *
+ * the counter comes from the HAL (include/hal.h):
+ * - on the MSP432 a free-running Timer32 counter clocked by MCLK / 16
+ * - on host builds (HOST_BUILD defined) the POSIX monotonic clock, counted in microseconds
+ * ticks wrap around, so they must only be used to measure intervals shorter than the wrap period
+ * (about 24 minutes with MCLK at 48 MHz, 71 minutes on the host)
+ */
+
+// typedef for a point in time, in timer ticks
+typedef uint32_t Ticks_t;
+
+
+// function that starts the time source
+// must be called once before any other Timer_ function
+void Timer_init(void);
+
+// function that returns the current time in ticks
+Ticks_t Timer_now(void);
+
+// function that returns the number of milliseconds elapsed since a point in time
+// Ticks_t start: point in time returned by an earlier call of Timer_now()
+uint32_t Timer_ms_since(Ticks_t start);
+
+// function that converts an interval in ticks to microseconds
+// Ticks_t ticks: difference of two points in time
+uint32_t Timer_ticks_to_us(Ticks_t ticks);
+
+#endif /* INCLUDE_TIMER_H_ */
@@ -0,0 +1,144 @@
+/*
+ * transposition.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+
+#ifndef INCLUDE_TRANSPOSITION_H_
+#define INCLUDE_TRANSPOSITION_H_
+
+
+/* transposition table used by minimax() to remember the positions it has already searched
+ *
+ * the table is a fixed array of buckets, each bucket holds TT_BUCKET_SIZE entries that share the same index.
+ * a position is stored in the bucket selected by the low bits of its zobrist hash and recognized by the high 32 bits
+ * of the hash (the lock), so two positions only get confused if 32 + TT_BUCKETS_LOG2 bits of their hash are equal.
+ *
+ * the table is statically allocated and its size is chosen at compile time with TT_BUCKETS_LOG2:
+ * - on the MSP432 the default is 512 buckets (16 KB out of the 64 KB of SRAM)
+ * - on host builds (HOST_BUILD defined) the default is 2^18 buckets (8 MB)
+ * both can be overridden by defining TT_BUCKETS_LOG2 in the compiler options
+ *
+ * the table is kept between the turns of a game, so what was searched for the previous move is reused,
+ * and it is cleared when a new game starts
+ *
+ * host tools can create more tables with TT_create() and choose the one every thread uses with TT_select(), e.g. one
+ * per engine in a match. on host builds the entries are read and written atomically, so the threads of a parallel
+ * search can share a table without locks (see host/source/lazysmp.c)
+ */
+
+#ifndef TT_BUCKETS_LOG2
+#ifdef HOST_BUILD
+#define TT_BUCKETS_LOG2 18
+#else
+#define TT_BUCKETS_LOG2 9
+#endif
+#endif
+
+#define TT_BUCKET_SIZE 4
+#define TT_NUM_BUCKETS ((uint32_t)1 << TT_BUCKETS_LOG2)
+
+// value of the move field when an entry has no best move
+#define TT_NO_MOVE ((Move_t)7)
+
+
+/* enum type of the kind of score stored in an entry:
+ * -BOUND_NONE:  the entry is empty
+ * -BOUND_EXACT: the score is the exact minimax value of the position
+ * -BOUND_LOWER: the search failed high, the real value is at least the score
+ * -BOUND_UPPER: the search failed low, the real value is at most the score
+ */
+typedef enum {
+    BOUND_NONE,
+    BOUND_EXACT,
+    BOUND_LOWER,
+    BOUND_UPPER
+} Bound_t;
+
+
+/* struct type of a single entry of the table, 8 bytes
+ *  lock:  high 32 bits of the zobrist hash of the position
+ *  score: score found by the search minus the position's Board_t.score, from the computer's point of view,
+ *         SCORE_MAX and SCORE_MIN (forced win or loss) are stored as they are
+ *  depth: remaining depth the position was searched with
+ *  info:  bits 0-2 best move (TT_NO_MOVE if none), bits 3-4 Bound_t, bits 5-7 generation the entry was written in
+ */
+typedef struct {
+    uint32_t lock;
+    Score_t score;
+    uint8_t depth;
+    uint8_t info;
+} TTEntry_t;
+
+#define TT_ENTRY_MOVE(e) ((Move_t)((e).info & 0x07))
+#define TT_ENTRY_BOUND(e) ((Bound_t)(((e).info >> 3) & 0x03))
+#define TT_ENTRY_GENERATION(e) ((uint8_t)((e).info >> 5))
+
+// a whole table with its generation counter
+typedef struct TTTable TTTable_t;
+
+
+/// @brief Empties the whole transposition table.
+///
+/// Must be called once before the first search and whenever a new game
+/// starts, since entries of an old game can never be reached again.
+void TT_clear(void);
+
+/// @brief Marks the beginning of a new search.
+///
+/// Entries written by earlier searches stay valid and can still be used,
+/// but they become the first candidates for replacement when a bucket
+/// is full.
+void TT_new_search(void);
+
+/// @brief Looks up a position in the table.
+///
+/// @param hash Zobrist hash of the position.
+/// @param entry Output: copy of the stored entry when found.
+///
+/// @return true if the position is in the table, false otherwise.
+bool TT_probe(Hash_t hash, TTEntry_t *entry);
+
+/// @brief Stores the result of a search in the table.
+///
+/// An existing entry of the same position is overwritten. Otherwise the
+/// entry of the bucket written by the oldest search is replaced, and
+/// among entries of the same age the one searched to the lowest depth.
+///
+/// @param hash Zobrist hash of the position.
+/// @param depth Remaining depth the position was searched with.
+/// @param score Score found by the search.
+/// @param bound Kind of score, see Bound_t.
+/// @param move Best move found, TT_NO_MOVE if none.
+void TT_store(Hash_t hash, uint8_t depth, Score_t score, Bound_t bound, Move_t move);
+
+#ifdef HOST_BUILD
+/// @brief Allocates an empty table, host builds only.
+///
+/// @return The new table, NULL if there is not enough memory.
+TTTable_t *TT_create(void);
+
+/// @brief Frees a table returned by TT_create().
+///
+/// A thread that was using it goes back to the default table.
+void TT_destroy(TTTable_t *table);
+
+/// @brief Chooses the table used by the TT_ functions in the calling thread.
+///
+/// Every thread starts on the statically allocated default table.
+///
+/// @param table Table returned by TT_create(), NULL for the default table.
+void TT_select(TTTable_t *table);
+
+/// @brief Returns the table used by the calling thread.
+///
+/// Other threads can pass it to TT_select() to share it.
+TTTable_t *TT_selected(void);
+#endif
+
+#endif /* INCLUDE_TRANSPOSITION_H_ */
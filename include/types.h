@@ -41,6 +41,32 @@ typedef int16_t Score_t;
 #define SCORE_MAX INT16_MAX
 
 
+// storage class of the state of the search (counters, move ordering tables, settings)
+// on host builds every thread gets its own copy, so that host tools can run several searches at the same time
+// the MSP432 has a single thread and keeps plain globals
+#ifdef HOST_BUILD
+#define THREAD_LOCAL _Thread_local
+#else
+#define THREAD_LOCAL
+#endif
+
+
+// typedef for the zobrist hash key of a connect 4 board, used to index the transposition table
+// it is the XOR of one random key for every piece on the board, see board.c
+typedef uint64_t Hash_t;
+
+
+// number of windows of 4 aligned cells on the board (24 horizontal, 21 vertical, 12 per diagonal direction)
+// and the most windows a single cell belongs to
+#define NUM_WINDOWS 69
+#define MAX_CELL_WINDOWS 13
+
+// a window counter holds the number of computer pieces in its low nibble and of human pieces in its high nibble
+#define WINDOW_P1(w) ((uint8_t)((w) & 0x0F))
+#define WINDOW_P2(w) ((uint8_t)((w) >> 4))
+#define WINDOW_PIECE(is_computer) ((uint8_t)((is_computer) ? 0x01 : 0x10))
+
+
 /* struct type to indicate the state of a connect 4 board
  *  p1 and p2: arrays of uint8_t elements used as bitfields that correspond to the columns of the connect 4 board, a vaule of 1 represents a place with a piece in it
  *             the least significant bit represents the lowest piece in that column and the most significant represents the highest
@@ -50,13 +76,24 @@ typedef int16_t Score_t;
  *             and all other pieces are guaranteed to have a piece in them
  *
  *  score:     Score_t variable used to keep track of how favorable the state the board is in is, used by the algorithm
+ *
+ *  moves:     number of pieces on the board, which is also the ply of the game the board is at
+ *
+ *  hash:      zobrist key of the pieces on the board, updated incrementally by Board_make_move() and Board_unmake_move()
+ *
+ *  windows:   pieces of each player in every window of 4 cells, see WINDOW_P1() and WINDOW_P2(). Board_make_move() and
+ *             Board_unmake_move() update the windows through the played cell (CELL_WINDOWS in board.c), so delta_score()
+ *             reads the counts instead of scanning the board
  */
 // board struct changed by Temuulen
 typedef struct {
     uint8_t p1[NUM_COLS];   // bot
     uint8_t p2[NUM_COLS];   // player
     uint8_t height[NUM_COLS];
+    uint8_t moves;
     Score_t score;
+    Hash_t hash;
+    uint8_t windows[NUM_WINDOWS];
 } Board_t;
 
 
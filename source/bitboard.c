@@ -0,0 +1,48 @@
+/*
+ * bitboard.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/bitboard.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+void BitBoard_init(BitBoard_t *b){
+    b->position = 0;
+    b->mask = 0;
+    b->moves = 0;
+}
+
+void BitBoard_from_board(BitBoard_t *b, const Board_t *board, bool computer_to_move){
+    uint64_t p1 = 0;
+    uint64_t p2 = 0;
+    Col_t c;
+    for (c = 0; c < NUM_COLS; c++) {
+        p1 |= (uint64_t)board->p1[c] << (c * BB_HEIGHT1);
+        p2 |= (uint64_t)board->p2[c] << (c * BB_HEIGHT1);
+    }
+    b->mask = p1 | p2;
+    b->position = computer_to_move ? p1 : p2;
+    b->moves = board->moves;
+}
+
+void BitBoard_mirror(BitBoard_t *dst, const BitBoard_t *src){
+    Col_t c;
+    dst->position = 0;
+    dst->mask = 0;
+    for (c = 0; c < NUM_COLS; c++) {
+        int shift = (NUM_COLS - 1 - 2 * c) * BB_HEIGHT1;
+        uint64_t column = BB_COLUMN_MASK(c);
+        if (shift >= 0) {
+            dst->position |= (src->position & column) << shift;
+            dst->mask |= (src->mask & column) << shift;
+        } else {
+            dst->position |= (src->position & column) >> -shift;
+            dst->mask |= (src->mask & column) >> -shift;
+        }
+    }
+    dst->moves = src->moves;
+}
@@ -13,6 +13,92 @@
 #include "stdbool.h"
 #include "string.h"
 
+// zobrist keys, one for every player and every cell of the board: ZOBRIST[is_computer][column][row]
+// the hash of a board is the XOR of the keys of all its pieces, so placing or removing a piece is a single XOR
+// the keys are constant so that they live in flash and every board built from the same moves gets the same hash
+static const Hash_t ZOBRIST[2][NUM_COLS][NUM_ROWS] = {
+    {   // human
+        {0x6E789E6AA1B965F4ULL, 0x06C45D188009454FULL, 0xF88BB8A8724C81ECULL, 0x1B39896A51A8749BULL, 0x53CB9F0C747EA2EAULL, 0x2C829ABE1F4532E1ULL},
+        {0xC584133AC916AB3CULL, 0x3EE5789041C98AC3ULL, 0xF3B8488C368CB0A6ULL, 0x657EECDD3CB13D09ULL, 0xC2D326E0055BDEF6ULL, 0x8621A03FE0BBDB7BULL},
+        {0x8E1F7555983AA92FULL, 0xB54E0F1600CC4D19ULL, 0x84BB3F97971D80ABULL, 0x7D29825C75521255ULL, 0xC3CF17102B7F7F86ULL, 0x3466E9A083914F64ULL},
+        {0xD81A8D2B5A4485ACULL, 0xDB01602B100B9ED7ULL, 0xA9038A921825F10DULL, 0xEDF5F1D90DCA2F6AULL, 0x54496AD67BD2634CULL, 0xDD7C01D4F5407269ULL},
+        {0x935E82F1DB4C4F7BULL, 0x69B82EBC92233300ULL, 0x40D29EB57DE1D510ULL, 0xA2F09DABB45C6316ULL, 0xEE521D7A0F4D3872ULL, 0xF16952EE72F3454FULL},
+        {0x377D35DEA8E40225ULL, 0x0C7DE8064963BAB0ULL, 0x05582D37111AC529ULL, 0xD254741F599DC6F7ULL, 0x69630F7593D108C3ULL, 0x417EF96181DAA383ULL},
+        {0x3C3C41A3B43343A1ULL, 0x6E19905DCBE531DFULL, 0x4FA9FA7324851729ULL, 0x84EB4454A792922AULL, 0x134F7096918175CEULL, 0x07DC930B302278A8ULL},
+    },
+    {   // computer
+        {0x12C015A97019E937ULL, 0xCC06C31652EBF438ULL, 0xECEE65630A691E37ULL, 0x3E84ECB1763E79ADULL, 0x690ED476743AAE49ULL, 0x774615D7B1A1F2E1ULL},
+        {0x22B353F04F4F52DAULL, 0xE3DDD86BA71A5EB1ULL, 0xDF268ADEB6513356ULL, 0x2098EB73D4367D77ULL, 0x03D6845323CE3C71ULL, 0xC952C5620043C714ULL},
+        {0x9B196BCA844F1705ULL, 0x30260345DD9E0EC1ULL, 0xCF448A5882BB9698ULL, 0xF4A578DCCBC87656ULL, 0xBFDEAED9A17B3C8FULL, 0xED79402D1D5C5D7BULL},
+        {0x55F070AB1CBBF170ULL, 0x3E00A34929A88F1DULL, 0xE255B237B8BB18FBULL, 0x2A7B67AF6C6AD50EULL, 0x466D5E7F3E46F143ULL, 0x42375CB399A4FC72ULL},
+        {0x8C8A1F148A8BB259ULL, 0x32FCAB5DAED5BDFCULL, 0x9E60398C8D8553C0ULL, 0xEE89CCEB8C4064C0ULL, 0xDB0215941D86A66FULL, 0x5CCDE78203C367A8ULL},
+        {0xF1BCBC6A1EC11786ULL, 0xEF054FCEEE954551ULL, 0xDF82012D0555C6DFULL, 0x292566FF72403C08ULL, 0xC4DD302A1BFA1137ULL, 0xD85F219DB5C554E1ULL},
+        {0x6A27FF807441BCD2ULL, 0x96A573E9B48216E8ULL, 0x46A9FDAC40BF0048ULL, 0x3DD12464A0EE15B4ULL, 0x451E521296A7EEA1ULL, 0x56E4398A98F8A0FDULL},
+    },
+};
+
+// windows through every cell: CELL_WINDOWS[column][row] = {number of windows, window indexes...}
+// the 69 windows are numbered by direction, then by the column and row of their first cell:
+// 0-23 horizontal, 24-44 vertical, 45-56 diagonal rising, 57-68 diagonal falling
+const uint8_t CELL_WINDOWS[NUM_COLS][NUM_ROWS][MAX_CELL_WINDOWS + 1] = {
+    {
+        { 3,  0, 24, 45},
+        { 4,  1, 24, 25, 46},
+        { 5,  2, 24, 25, 26, 47},
+        { 5,  3, 24, 25, 26, 57},
+        { 4,  4, 25, 26, 58},
+        { 3,  5, 26, 59},
+    },
+    {
+        { 4,  0,  6, 27, 48},
+        { 6,  1,  7, 27, 28, 45, 49},
+        { 8,  2,  8, 27, 28, 29, 46, 50, 57},
+        { 8,  3,  9, 27, 28, 29, 47, 58, 60},
+        { 6,  4, 10, 28, 29, 59, 61},
+        { 4,  5, 11, 29, 62},
+    },
+    {
+        { 5,  0,  6, 12, 30, 51},
+        { 8,  1,  7, 13, 30, 31, 48, 52, 57},
+        {11,  2,  8, 14, 30, 31, 32, 45, 49, 53, 58, 60},
+        {11,  3,  9, 15, 30, 31, 32, 46, 50, 59, 61, 63},
+        { 8,  4, 10, 16, 31, 32, 47, 62, 64},
+        { 5,  5, 11, 17, 32, 65},
+    },
+    {
+        { 7,  0,  6, 12, 18, 33, 54, 57},
+        {10,  1,  7, 13, 19, 33, 34, 51, 55, 58, 60},
+        {13,  2,  8, 14, 20, 33, 34, 35, 48, 52, 56, 59, 61, 63},
+        {13,  3,  9, 15, 21, 33, 34, 35, 45, 49, 53, 62, 64, 66},
+        {10,  4, 10, 16, 22, 34, 35, 46, 50, 65, 67},
+        { 7,  5, 11, 17, 23, 35, 47, 68},
+    },
+    {
+        { 5,  6, 12, 18, 36, 60},
+        { 8,  7, 13, 19, 36, 37, 54, 61, 63},
+        {11,  8, 14, 20, 36, 37, 38, 51, 55, 62, 64, 66},
+        {11,  9, 15, 21, 36, 37, 38, 48, 52, 56, 65, 67},
+        { 8, 10, 16, 22, 37, 38, 49, 53, 68},
+        { 5, 11, 17, 23, 38, 50},
+    },
+    {
+        { 4, 12, 18, 39, 63},
+        { 6, 13, 19, 39, 40, 64, 66},
+        { 8, 14, 20, 39, 40, 41, 54, 65, 67},
+        { 8, 15, 21, 39, 40, 41, 51, 55, 68},
+        { 6, 16, 22, 40, 41, 52, 56},
+        { 4, 17, 23, 41, 53},
+    },
+    {
+        { 3, 18, 42, 66},
+        { 4, 19, 42, 43, 67},
+        { 5, 20, 42, 43, 44, 68},
+        { 5, 21, 42, 43, 44, 54},
+        { 4, 22, 43, 44, 55},
+        { 3, 23, 44, 56},
+    },
+};
+
 void Board_init(Board_t* board){
     memset(board, 0, sizeof(Board_t));
 }
@@ -24,27 +110,36 @@ void Board_make_move(Board_t* board, const Move_t move, const bool is_computer,
         board->p1[move] |= mask;
     else 
         board->p2[move] |= mask;
+    board->hash ^= ZOBRIST[is_computer][move][r];
     board->height[move]++;
+    board->moves++;
     board->score += delta;
+
+    const uint8_t *w = CELL_WINDOWS[move][r];
+    uint8_t piece = WINDOW_PIECE(is_computer);
+    uint8_t i;
+    for (i = 1; i <= w[0]; i++) board->windows[w[i]] += piece;
 }
 
 void Board_unmake_move(Board_t* board, const Move_t move, const bool is_computer, Score_t delta){
     board->height[move]--;
+    board->moves--;
     uint8_t r = board->height[move];
     uint8_t mask = (1 << r);
     if (is_computer) 
         board->p1[move] &= ~mask;
     else 
         board->p2[move] &= ~mask;
+    board->hash ^= ZOBRIST[is_computer][move][r];
     board->score -= delta;
+
+    const uint8_t *w = CELL_WINDOWS[move][r];
+    uint8_t piece = WINDOW_PIECE(is_computer);
+    uint8_t i;
+    for (i = 1; i <= w[0]; i++) board->windows[w[i]] -= piece;
 }
 
 bool Board_full(const Board_t *board)
 {
-    Col_t i;
-    for (i = 0; i < NUM_COLS; i++) {
-        if (board->height[i] < NUM_ROWS) 
-        return false;
-    }
-    return true;
+    return board->moves >= NUM_COLS * NUM_ROWS;
 }
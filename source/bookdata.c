@@ -0,0 +1,49 @@
+/*
+ * bookdata.c
+ *
+ *  Generated by host/tools/gen_book.c, do not edit
+ */
+
+/* opening book of the first 6 plies: 176 positions, 531 bytes of flash
+ * see include/openingbook.h for the format
+ */
+
+#include "include/openingbook.h"
+#include "stdint.h"
+
+const uint8_t BOOK_PLIES = 6;
+const uint16_t BOOK_NUM_BUCKETS = 89;
+const uint16_t BOOK_NUM_SLOTS = 221;
+
+const uint8_t book_displacements[89] = {
+      0,   0,   0,   7,   0,   0,   1,   1,   0,   2,   0,   3,
+      1,   0,   0,   5,   0,   0,   0,   9,   1,   1,   0,   1,
+      0,   3,   4,   0,   1,   0,   1,   0,   9,   7,   3,   1,
+      0,   0,   4,   2,   3,   0,  10,   0,   2,  12,   2,  15,
+      0,   1,   3,   4,   0,   0,  10,   0,   0,   9,   1,   6,
+      3,   0,   2,  11,   3,   0,   2,   0,  12,   6,   7,   0,
+      0,   5,   1,   3,   1,   0,   7,   0,   2,   0,   3,   1,
+      0,   2,   0,  12,   3,
+};
+
+const BookEntry_t book_slots[221] = {
+    0xa7a3, 0x7423, 0x0007, 0x0007, 0x2063, 0x45ab, 0x0007, 0x46a2, 0x2aaa, 0x2a73, 0x0853, 0x2bc3,
+    0x70c3, 0xb662, 0xb213, 0x203c, 0x7d8a, 0x21c3, 0x0007, 0x30fc, 0x0007, 0x5e39, 0x180a, 0x1da3,
+    0xcffa, 0x0007, 0xec2b, 0x2d2a, 0x2ec2, 0xf403, 0x91e2, 0xeff3, 0x5c83, 0x100b, 0x632b, 0x1c63,
+    0xa67c, 0x7513, 0x3adb, 0x5cec, 0x0874, 0x0007, 0x9c5a, 0x59cb, 0xcee4, 0xd6fb, 0xfc62, 0x0007,
+    0x418b, 0xc67a, 0x8373, 0xc4c3, 0x4bdb, 0x0007, 0x5c0b, 0xfc3b, 0x5f9b, 0x0007, 0x07a2, 0xcaac,
+    0xf6db, 0x0a83, 0x0007, 0x232b, 0x0f63, 0xa632, 0x0007, 0x6a73, 0x425b, 0x6c23, 0x7e43, 0x0007,
+    0xfb7a, 0xfa1b, 0xbb1a, 0xf45a, 0xa252, 0x784a, 0x0daa, 0x0cdd, 0x0007, 0x89da, 0x5741, 0x43c1,
+    0xfde3, 0x0007, 0x801a, 0x58db, 0xd483, 0x9553, 0x0007, 0xb9e3, 0x4e74, 0x3e3b, 0xd053, 0x0007,
+    0xd9bc, 0x0007, 0xa7ec, 0xe303, 0x0feb, 0x0007, 0x32b3, 0x53bb, 0x0007, 0xaf3c, 0x55a8, 0x5a83,
+    0x1063, 0x46f2, 0xb5db, 0xfea4, 0x13ab, 0x3fc3, 0xb783, 0x7fa8, 0xcfc3, 0x0007, 0xd833, 0xdc14,
+    0x1c3a, 0x0007, 0x9f03, 0x748a, 0x0003, 0x0313, 0x0007, 0x49a2, 0xab99, 0x48ab, 0x0007, 0xa60b,
+    0x8f23, 0xd42b, 0x7773, 0xbc13, 0x0bc3, 0xdcb3, 0x0d52, 0x4343, 0x7bc3, 0x66b2, 0x0007, 0xbd3b,
+    0x0007, 0xb55b, 0x57f3, 0x208a, 0x0007, 0xa184, 0x717a, 0xd1da, 0xd35b, 0x0007, 0xcecb, 0x40c3,
+    0x0007, 0xdb1b, 0x7dfb, 0x5beb, 0x320b, 0xada1, 0xb172, 0x392b, 0x198d, 0x0007, 0x7f83, 0x9d23,
+    0x0007, 0x43cb, 0x0007, 0x0007, 0x1853, 0xc1e3, 0xda53, 0x7343, 0xb1f2, 0xa974, 0x0007, 0xe562,
+    0x5472, 0xb93a, 0xe053, 0x1434, 0x0007, 0xcea1, 0x0007, 0xe40a, 0x0007, 0xb75b, 0x3ee3, 0x2740,
+    0xa59b, 0x0007, 0x3783, 0x0007, 0x0007, 0x2de9, 0x7b12, 0x0007, 0x8303, 0x02fb, 0xf9f1, 0x0007,
+    0xdbf3, 0x1a0b, 0x0007, 0x0007, 0xcb3b, 0x2193, 0xa91d, 0xa4fb, 0xba84, 0x5e2c, 0x4c53, 0x0007,
+    0xa48a, 0x2123, 0xa673, 0x09eb, 0xf74a,
+};
@@ -13,8 +13,141 @@
 #include "include/connect4algorithm.h"
 #include "include/types.h"
 #include "include/board.h"
+#include "include/bitboard.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "include/openingbook.h"
+#include "include/evalweights.h"
 #include "include/displaycontroller.h"
+#include "include/searchstats.h"
+#include "include/ponder.h"
 #include "stdio.h"
+#include "string.h"
+#ifndef NDEBUG
+#include "math.h"
+#endif
+
+// number of positions visited by minimax() since the start of the current search
+THREAD_LOCAL uint32_t search_nodes;
+
+// deepest iteration completed by the last call of iterative_deepening()
+THREAD_LOCAL uint8_t search_depth;
+
+// time budget of the running search: iterative_deepening() sets them, minimax() polls the clock every
+// SEARCH_POLL_NODES nodes and raises search_aborted once the budget is spent
+#define SEARCH_POLL_NODES 1024
+static THREAD_LOCAL Ticks_t search_start;
+static THREAD_LOCAL uint32_t search_budget_ms;
+static THREAD_LOCAL bool search_aborted;
+
+// searches stopped from outside: helper threads of the parallel search and pondering, see include/connect4algorithm.h
+THREAD_LOCAL const volatile bool *search_stop;
+THREAD_LOCAL uint8_t search_first_depth = 1;
+
+// number of pieces on the board at the root of the search, the ply of a node is b->moves - root_moves
+static THREAD_LOCAL uint8_t root_moves;
+
+// triangular principal variation table: pv_table[ply] holds the best line found from the node at that ply,
+// pv_length[ply] its length. a node copies the line of its best child behind its own best move
+static THREAD_LOCAL Move_t pv_table[MAX_PLY + 1][MAX_PLY + 1];
+static THREAD_LOCAL uint8_t pv_length[MAX_PLY + 1];
+
+// principal variation of the last completed iteration, searched first by the next one
+// follow_pv stays true while the nodes being searched are the ones along that line
+static THREAD_LOCAL Move_t prev_pv[MAX_PLY];
+static THREAD_LOCAL uint8_t prev_pv_length;
+static THREAD_LOCAL bool follow_pv;
+
+// root search used by iterative_deepening(), see Algorithm_t
+THREAD_LOCAL Algorithm_t search_algorithm = SEARCH_ALGORITHM;
+
+// whether leaf positions add threat_score() to the incremental score, see EVAL_THREATS
+THREAD_LOCAL bool eval_threats = EVAL_THREATS;
+
+// weights of the evaluation, see include/evalweights.h
+#ifdef HOST_BUILD
+THREAD_LOCAL Score_t eval_weights[NUM_EVAL_WEIGHTS] = EVAL_WEIGHTS;
+#else
+const Score_t eval_weights[NUM_EVAL_WEIGHTS] = EVAL_WEIGHTS;
+#endif
+
+// weights of the threat analysis: threats on the row parity that wins the zugzwang, threats on the other parity,
+// a threat the side to move can play right away (a win next move) and one it has to block right away
+#define THREAT_GOOD      eval_weights[WEIGHT_THREAT_GOOD]
+#define THREAT_WEAK      eval_weights[WEIGHT_THREAT_WEAK]
+#define THREAT_IMMEDIATE eval_weights[WEIGHT_THREAT_IMMEDIATE]
+#define THREAT_FORCING   eval_weights[WEIGHT_THREAT_FORCING]
+
+// rows 1, 3 and 5 of the board counting from 1, the rows the first player's threats have to be on
+#define BB_ODD_ROWS (BB_BOTTOM_MASK * 0x15)
+
+// half width of the first aspiration window around the previous iteration's score
+#define ASPIRATION_WINDOW 32
+
+// counts a node and checks the time budget, returns true once the search has to be abandoned
+// only a completed iteration gives a move to fall back on, so the first one is never interrupted
+static bool search_poll(void)
+{
+    search_nodes++;
+    if ((search_nodes & (SEARCH_POLL_NODES - 1)) == 0) {
+        if (search_depth > 0 && Timer_ms_since(search_start) >= search_budget_ms) search_aborted = true;
+        // a helper or a ponder search has no move to return, it can stop at any time
+        if (search_stop && *search_stop) search_aborted = true;
+    }
+    return search_aborted;
+}
+
+// negamax() scores positions from the point of view of the side to move, the transposition table and minimax()
+// from the computer's. the two conversions below also map a loss, -SCORE_MAX for negamax(), to SCORE_MIN
+static Score_t absolute_score(Score_t score, bool maximizing)
+{
+    if (!maximizing) score = -score;
+    return (score == -SCORE_MAX) ? SCORE_MIN : score;
+}
+
+static Score_t relative_score(Score_t score, bool maximizing)
+{
+    if (score == SCORE_MIN) score = -SCORE_MAX;
+    return maximizing ? score : -score;
+}
+
+// b->score sums the delta_score() of the moves that led to the position, so it depends on the path.
+// the table keeps only what the search added below the position, a forced win or loss is kept as it is
+static Score_t tt_score_store(const Board_t *b, Score_t score)
+{
+    if (score == SCORE_MAX || score == SCORE_MIN) return score;
+    int32_t stored = (int32_t)score - b->score;
+    if (stored >= SCORE_MAX) return SCORE_MAX - 1;
+    if (stored <= SCORE_MIN) return SCORE_MIN + 1;
+    return (Score_t)stored;
+}
+
+static Score_t tt_score_probe(const Board_t *b, Score_t score)
+{
+    if (score == SCORE_MAX || score == SCORE_MIN) return score;
+    int32_t probed = (int32_t)score + b->score;
+    if (probed >= SCORE_MAX) return SCORE_MAX - 1;
+    if (probed <= SCORE_MIN) return SCORE_MIN + 1;
+    return (Score_t)probed;
+}
+
+// a lower bound for the human is an upper bound for the computer and vice versa
+static Bound_t flip_bound(Bound_t bound, bool maximizing)
+{
+    if (maximizing) return bound;
+    if (bound == BOUND_LOWER) return BOUND_UPPER;
+    if (bound == BOUND_UPPER) return BOUND_LOWER;
+    return bound;
+}
+
+// copies the best line of the child behind the move that leads to it
+static void update_pv(uint8_t ply, Move_t move)
+{
+    pv_table[ply][0] = move;
+    memcpy(&pv_table[ply][1], pv_table[ply + 1], pv_length[ply + 1]);
+    pv_length[ply] = pv_length[ply + 1] + 1;
+}
 
 Score_t eval_window(uint8_t p1, uint8_t p2, bool player)
 {
@@ -23,99 +156,96 @@ Score_t eval_window(uint8_t p1, uint8_t p2, bool player)
 
     // empty 
     if (!(p1 | p2)) {
-        return player ? 1 : -1;
+        return player ? eval_weights[WEIGHT_EMPTY] : -eval_weights[WEIGHT_EMPTY];
     }
 
     if(player) {
         if(p1) {
-            return (p1 == 3) ? 95 : (1 << p1);
+            return (p1 == 3) ? EVAL_WIN : eval_weights[WEIGHT_OWN_1 + p1 - 1];
         }
         else {
-            return (p2 == 3) ? 5 : (1 << (p2 - 1));
+            return eval_weights[WEIGHT_ENEMY_1 + p2 - 1];
         }
     }
 
     else {
         if(p2) {
-            return (p2 == 3) ? -95 : -(1 << p2);
+            return (p2 == 3) ? -EVAL_WIN : -eval_weights[WEIGHT_OWN_1 + p2 - 1];
         }
         else {
-            return (p1 == 3) ? -5 : -(1 << (p1 - 1));
+            return -eval_weights[WEIGHT_ENEMY_1 + p1 - 1];
         }
     }
 }
 
+// every cell above a cell of t in the same column, filled one row at a time so it stops at the sentinel row
+static uint64_t cells_above(uint64_t t)
+{
+    uint8_t i;
+    uint64_t above = 0;
+    for (i = 1; i < NUM_ROWS; i++) {
+        t = (t << 1) & BB_BOARD_MASK;
+        above |= t;
+    }
+    return above;
+}
+
+Score_t threat_score(const Board_t *b, bool maximizing)
+{
+    BitBoard_t bb;
+    BitBoard_from_board(&bb, b, true);
+
+    uint64_t computer = BitBoard_winning_cells(bb.position, bb.mask);
+    uint64_t human = BitBoard_winning_cells(bb.position ^ bb.mask, bb.mask);
+    uint64_t playable = BitBoard_playable(&bb);
+
+    // the lowest threat of a column is filled first, a threat of the other side above it never gets played
+    uint64_t dead_computer = computer & cells_above(human);
+    human &= ~cells_above(computer);
+    computer &= ~dead_computer;
+
+    // threats that can be played right now are a win for the side to move and a forced block for the other
+    uint64_t now_computer = computer & playable;
+    uint64_t now_human = human & playable;
+    Score_t score = maximizing
+        ? THREAT_IMMEDIATE * (now_computer != 0) - THREAT_FORCING * (now_human != 0)
+        : THREAT_FORCING * (now_computer != 0) - THREAT_IMMEDIATE * (now_human != 0);
+    computer ^= now_computer;
+    human ^= now_human;
+
+    // the others decide the endgame by zugzwang: the first player wants them on odd rows, the second on even rows
+    bool computer_first = maximizing == ((b->moves & 1) == 0);
+    uint64_t computer_rows = computer_first ? BB_ODD_ROWS : (BB_BOARD_MASK ^ BB_ODD_ROWS);
+    uint64_t human_rows = BB_BOARD_MASK ^ computer_rows;
+
+    score += THREAT_GOOD * ((Score_t)BitBoard_count(computer & computer_rows) -
+                            (Score_t)BitBoard_count(human & human_rows));
+    score += THREAT_WEAK * ((Score_t)BitBoard_count(computer & human_rows) -
+                            (Score_t)BitBoard_count(human & computer_rows));
+    return score;
+}
+
+// score of a leaf from the computer's point of view: incremental window score plus the threat analysis
+static Score_t static_eval(const Board_t *b, bool maximizing)
+{
+    STATS_LEAF();
+    if (!eval_threats) return b->score;
+    return b->score + threat_score(b, maximizing);
+}
+
 Score_t delta_score(Board_t *b, Col_t col, int row, bool player)
 {
+    // the cell is still empty, so the counters of its windows hold the pieces of the other 3 cells
+    const uint8_t *w = CELL_WINDOWS[col][row];
     Score_t total_delta = -1;
     Score_t delta;
-    int8_t d, i;
-    for (d = 0; d < 4; d++) {
-        uint8_t dir = DIRS[d];
-        int8_t dx = GET_DX(dir);
-        int8_t dy = GET_DY(dir);
-
-        int8_t p1_count = 0;
-        int8_t p2_count = 0;
-        int8_t cells = 0;
-
-        // counted first 3 cells 
-        for (i = 3; i > 0; i--) {
-            int8_t c = col - i * dx;
-            int8_t r = row - i * dy;
-            
-            if ((c >= 0) & (c < NUM_COLS) & (r >= 0) & (r < NUM_ROWS)) {
-                uint8_t m = (1 << r);
-                p1_count += (b->p1[c] & m) ? 1 : 0;
-                p2_count += (b->p2[c] & m) ? 1 : 0;
-                cells++;
-            }
-            else { continue; }
-        }
-
-        // check if we have window 
-        if(cells >= 3) {
-            delta = eval_window(p1_count, p2_count, player);
-            if (delta == 95) return SCORE_MAX;
-            if (delta == -95) return SCORE_MIN;
-            total_delta += delta;
-        }
-
-        // counted last 3 cells
-        for (i = 1; i <= 3; i++) {
-
-            int8_t c = col + i * dx;
-            int8_t r = row + i * dy;
-            
-            // check next cell is valid
-            if ((c >= 0) & (c < NUM_COLS) & (r >= 0) & (r < NUM_ROWS)) {
-                uint8_t m = (1 << r);
-                p1_count += (b->p1[c] & m) ? 1 : 0;
-                p2_count += (b->p2[c] & m) ? 1 : 0;
-                cells++;
-
-                // check if we have window 
-                if(cells >= 3) {
-                    // Remove leftmost cell if window has 4 cells
-                    if(cells >= 4) {
-                        int8_t c_del = c - (dx << 2); // multiply by 4 using shift
-                        int8_t r_del = r - (dy << 2);
-                        uint8_t m_del = (1 << r_del);
-                        p1_count -= (b->p1[c_del] & m_del) ? 1 : 0;
-                        p2_count -= (b->p2[c_del] & m_del) ? 1 : 0;
-                    }
-
-                    delta = eval_window(p1_count, p2_count, player);
-                    if (delta == 95) return SCORE_MAX;
-                    if (delta == -95) return SCORE_MIN;
-                    total_delta += delta;
-                }
-        
-            }
-            // if not no need to continue
-            else { break; }
-        }
-
+    uint8_t i;
+    for (i = 1; i <= w[0]; i++) {
+        uint8_t counts = b->windows[w[i]];
+        delta = eval_window(WINDOW_P1(counts), WINDOW_P2(counts), player);
+        if (delta == EVAL_WIN) return SCORE_MAX;
+        if (delta == -EVAL_WIN) return SCORE_MIN;
+        total_delta += delta;
     }
     return total_delta;
 }
@@ -123,17 +253,64 @@ Score_t delta_score(Board_t *b, Col_t col, int row, bool player)
 Result_t minimax(Board_t *b, int depth, 
                  bool maximizing, Score_t alpha, Score_t beta)
 {
+    uint8_t ply = b->moves - root_moves;
+    pv_length[ply] = 0;
+    STATS_PLY(ply);
+
+    if (search_poll())
+        return (Result_t){0, b->score};
+
     // board is full or 0 depth
     if (depth == 0 || Board_full(b))
-        return (Result_t){0, b->score};
+        return (Result_t){0, static_eval(b, maximizing)};
+
+    // look the position up in the transposition table:
+    // a deep enough entry can narrow the window or end the search here, and its best move is searched first
+    Score_t alpha_orig = alpha;
+    Score_t beta_orig = beta;
+    Move_t tt_move = TT_NO_MOVE;
+    TTEntry_t entry;
+    if (TT_probe(b->hash, &entry)) {
+        tt_move = TT_ENTRY_MOVE(entry);
+        if (entry.depth >= depth) {
+            Score_t score = tt_score_probe(b, entry.score);
+            switch (TT_ENTRY_BOUND(entry)) {
+                case BOUND_EXACT:
+                    return (Result_t){tt_move, score};
+                case BOUND_LOWER:
+                    if (score > alpha) alpha = score;
+                    break;
+                case BOUND_UPPER:
+                    if (score < beta) beta = score;
+                    break;
+                default:
+                    break;
+            }
+            if (alpha >= beta)
+                return (Result_t){tt_move, score};
+        }
+    }
+
+    // while we are on the principal variation of the previous iteration, its move is searched first
+    Move_t pv_move = TT_NO_MOVE;
+    if (follow_pv) {
+        if (ply < prev_pv_length) pv_move = prev_pv[ply];
+        else follow_pv = false;
+    }
+
+    // legal columns, most promising first
+    Move_t order[NUM_COLS];
+    uint8_t num_moves = MoveOrder_sort(b, maximizing, pv_move, tt_move, order);
+    uint8_t i;
 
     Result_t best;
-    best.move = 0;
+    best.move = order[0];
     best.score = maximizing ? SCORE_MIN : SCORE_MAX;
     Col_t c;
 
-    for (c = 0; c < NUM_COLS; c++) {
-        if (b->height[c] >= NUM_ROWS) continue;
+    for (i = 0; i < num_moves; i++) {
+        c = order[i];
+        STATS_ROOT_BEGIN(ply);
         int8_t row = b->height[c];
         // calculate how score will change 
         Score_t delta = delta_score(b, c, row, maximizing);
@@ -142,9 +319,11 @@ Result_t minimax(Board_t *b, int depth,
         // There is a winning move in 1
         if((delta == SCORE_MAX) & maximizing) {
             r = (Result_t){c, SCORE_MAX};
+            pv_length[ply + 1] = 0;
         }
         else if((delta == SCORE_MIN) & !maximizing) {
             r = (Result_t){c, SCORE_MIN};
+            pv_length[ply + 1] = 0;
         }
 
         else {
@@ -153,58 +332,327 @@ Result_t minimax(Board_t *b, int depth,
                                 !maximizing, alpha, beta);  
             Board_unmake_move(b, c, maximizing, delta);     // 3. revert board
         }
+        STATS_ROOT_END(ply, c);
+
+        // only the first move of a node can continue the previous principal variation
+        follow_pv = false;
+        if (search_aborted) return best;
         
+        bool improved = maximizing ? (r.score > best.score) : (r.score < best.score);
+        if (improved) {
+            best.score = r.score;
+            best.move = c;
+            update_pv(ply, c);
+        }
+
         if (maximizing) {
-            if (r.score > best.score) {
-                best.score = r.score;
-                best.move = c;
-            }
             if (best.score > alpha) alpha = best.score;
         } else {
-            if (r.score < best.score) {
-                best.score = r.score;
-                best.move = c;
-            }
             if (best.score < beta) beta = best.score;
         }
 
-        if (alpha >= beta) break;
+        if (alpha >= beta) {
+            STATS_CUTOFF(i);
+            MoveOrder_cutoff(b, maximizing, c, depth);
+            break;
+        }
     }
+
+    // a score outside the original window is only a bound on the real value
+    Bound_t bound = BOUND_EXACT;
+    if (best.score <= alpha_orig) bound = BOUND_UPPER;
+    else if (best.score >= beta_orig) bound = BOUND_LOWER;
+    TT_store(b->hash, depth, tt_score_store(b, best.score), bound, best.move);
+
     return best;
 }
 
-void fn_CALCULATING_MOVE(void) {
+Result_t negamax(Board_t *b, int depth,
+                 bool maximizing, Score_t alpha, Score_t beta)
+{
+    uint8_t ply = b->moves - root_moves;
+    pv_length[ply] = 0;
+    STATS_PLY(ply);
 
-    //write the waiting indicator on the display
-    Display_write();
+    if (search_poll())
+        return (Result_t){0, maximizing ? b->score : -b->score};
+
+    // board is full or 0 depth
+    if (depth == 0 || Board_full(b)) {
+        Score_t static_score = static_eval(b, maximizing);
+        return (Result_t){0, maximizing ? static_score : -static_score};
+    }
+
+    // transposition table lookup, entries are stored from the computer's point of view
+    Score_t alpha_orig = alpha;
+    Score_t beta_orig = beta;
+    Move_t tt_move = TT_NO_MOVE;
+    TTEntry_t entry;
+    if (TT_probe(b->hash, &entry)) {
+        tt_move = TT_ENTRY_MOVE(entry);
+        if (entry.depth >= depth) {
+            Score_t score = relative_score(tt_score_probe(b, entry.score), maximizing);
+            Bound_t bound = flip_bound(TT_ENTRY_BOUND(entry), maximizing);
+            if (bound == BOUND_EXACT)
+                return (Result_t){tt_move, score};
+            if (bound == BOUND_LOWER && score > alpha) alpha = score;
+            if (bound == BOUND_UPPER && score < beta) beta = score;
+            if (alpha >= beta)
+                return (Result_t){tt_move, score};
+        }
+    }
+
+    Move_t pv_move = TT_NO_MOVE;
+    if (follow_pv) {
+        if (ply < prev_pv_length) pv_move = prev_pv[ply];
+        else follow_pv = false;
+    }
+
+    Move_t order[NUM_COLS];
+    uint8_t num_moves = MoveOrder_sort(b, maximizing, pv_move, tt_move, order);
+    uint8_t i;
+
+    Result_t best;
+    best.move = order[0];
+    best.score = -SCORE_MAX;
+    Col_t c;
+
+    for (i = 0; i < num_moves; i++) {
+        c = order[i];
+        STATS_ROOT_BEGIN(ply);
+        Score_t delta = delta_score(b, c, b->height[c], maximizing);
+        Score_t score;
+
+        if (delta == (maximizing ? SCORE_MAX : SCORE_MIN)) {
+            // winning move in 1
+            score = SCORE_MAX;
+            pv_length[ply + 1] = 0;
+        }
+        else {
+            Board_make_move(b, c, maximizing, delta);
+            if (i == 0) {
+                // the first move is expected to be the best one: full window
+                score = -negamax(b, depth - 1, !maximizing, -beta, -alpha).score;
+            }
+            else {
+                // the others only have to be proven worse: null window, and a real search only if they are not
+                score = -negamax(b, depth - 1, !maximizing, -alpha - 1, -alpha).score;
+                if (score > alpha && score < beta && !search_aborted)
+                    score = -negamax(b, depth - 1, !maximizing, -beta, -alpha).score;
+            }
+            Board_unmake_move(b, c, maximizing, delta);
+        }
+        STATS_ROOT_END(ply, c);
+
+        follow_pv = false;
+        if (search_aborted) return best;
+
+        if (score > best.score) {
+            best.score = score;
+            best.move = c;
+            update_pv(ply, c);
+        }
+        if (best.score > alpha) alpha = best.score;
+
+        if (alpha >= beta) {
+            STATS_CUTOFF(i);
+            MoveOrder_cutoff(b, maximizing, c, depth);
+            break;
+        }
+    }
+
+    Bound_t bound = BOUND_EXACT;
+    if (best.score <= alpha_orig) bound = BOUND_UPPER;
+    else if (best.score >= beta_orig) bound = BOUND_LOWER;
+    TT_store(b->hash, depth, tt_score_store(b, absolute_score(best.score, maximizing)), flip_bound(bound, maximizing),
+             best.move);
+
+    return best;
+}
+
+// root search of an iteration with aspiration windows: the window starts narrow around the score of the previous
+// iteration and is widened on the side that failed until the score falls inside it
+static Result_t aspiration_search(Board_t *b, bool maximizing, int depth, Score_t guess, bool has_guess)
+{
+    Score_t alpha = -SCORE_MAX;
+    Score_t beta = SCORE_MAX;
+    int16_t window = ASPIRATION_WINDOW;
+
+    if (has_guess && guess > -SCORE_MAX + 2 * ASPIRATION_WINDOW && guess < SCORE_MAX - 2 * ASPIRATION_WINDOW) {
+        alpha = guess - window;
+        beta = guess + window;
+    }
+
+    while (1) {
+        follow_pv = true;
+        Result_t r = negamax(b, depth, maximizing, alpha, beta);
+        if (search_aborted) return r;
+
+        if (r.score <= alpha && alpha > -SCORE_MAX) {
+            window *= 4;
+            alpha = (r.score > -SCORE_MAX + window) ? r.score - window : -SCORE_MAX;
+        }
+        else if (r.score >= beta && beta < SCORE_MAX) {
+            window *= 4;
+            beta = (r.score < SCORE_MAX - window) ? r.score + window : SCORE_MAX;
+        }
+        else {
+            return r;
+        }
+    }
+}
+
+// root search of an iteration with MTD(f): a sequence of null window searches that move the bounds of the score
+// towards each other, starting from the score of the previous iteration. relies on the transposition table
+// to make each re-search cheap
+static Result_t mtdf(Board_t *b, bool maximizing, int depth, Score_t guess)
+{
+    Score_t lower = -SCORE_MAX;
+    Score_t upper = SCORE_MAX;
+    Result_t r = {0, guess};
+    Result_t best = {TT_NO_MOVE, guess};
+
+    while (lower < upper) {
+        Score_t beta = (r.score == lower) ? r.score + 1 : r.score;
+        follow_pv = true;
+        r = negamax(b, depth, maximizing, beta - 1, beta);
+        if (search_aborted) return r;
+
+        if (r.score < beta) {
+            upper = r.score;
+        } else {
+            // only a search that failed high has proven its move
+            lower = r.score;
+            best.move = r.move;
+        }
+        best.score = r.score;
+    }
+    if (best.move == TT_NO_MOVE) best.move = r.move;
+    return best;
+}
+
+Result_t iterative_deepening(Board_t *b, bool maximizing, int max_depth, uint32_t budget_ms)
+{
+    int remaining = NUM_COLS * NUM_ROWS - b->moves;
+    int depth;
+
+    search_start = Timer_now();
+    search_budget_ms = budget_ms;
+    search_aborted = false;
+    search_nodes = 0;
+    search_depth = 0;
+    root_moves = b->moves;
+    prev_pv_length = 0;
+
+    // entries of the previous turns are kept, but they are replaced before the ones of this search
+    // a helper shares the table of the main thread, which starts the new search for both
+    if (!search_stop) TT_new_search();
+    MoveOrder_new_search();
+
+    // there is no point in searching deeper than the end of the game
+    if (max_depth > remaining) max_depth = remaining;
+
+    int first_depth = 1;
+    if (search_stop) first_depth = search_first_depth;
+
+    Result_t best = {0, b->score};
+    Score_t guess = 0;
+    for (depth = first_depth; depth <= max_depth; depth++) {
+        Result_t r;
+        switch (search_algorithm) {
+            case ALGORITHM_PVS:
+                r = aspiration_search(b, maximizing, depth, guess, depth > 1);
+                guess = r.score;
+                r.score = absolute_score(r.score, maximizing);
+                break;
+            case ALGORITHM_MTDF:
+                r = mtdf(b, maximizing, depth, guess);
+                guess = r.score;
+                r.score = absolute_score(r.score, maximizing);
+                break;
+            default:
+                follow_pv = true;
+                r = minimax(b, depth, maximizing, SCORE_MIN, SCORE_MAX);
+                break;
+        }
+
+        // the deadline expired during this iteration: keep the move of the last completed one
+        if (search_aborted) break;
+
+        best = r;
+        search_depth = depth;
+        memcpy(prev_pv, pv_table[0], pv_length[0]);
+        prev_pv_length = pv_length[0];
+
+        // a forced win or loss does not change with more depth
+        if (r.score == SCORE_MAX || r.score == SCORE_MIN) break;
+    }
+    return best;
+}
+
+Col_t choose_move(Board_t *b, bool maximizing, int max_depth, uint32_t budget_ms)
+{
+    search_nodes = 0;
+    search_depth = 0;
+    STATS_RESET();
 
     // check one move win
     Col_t c;
     for (c = 0; c < NUM_COLS; c++) {
-        if (game_board.height[c] >= NUM_ROWS) continue;
-        int8_t row = game_board.height[c];
+        if (b->height[c] >= NUM_ROWS) continue;
+        int8_t row = b->height[c];
 
         // calculate how score will change 
-        Score_t delta = delta_score(&game_board, c, row, true);
-        if((delta == SCORE_MAX)) {
-            move_to_make = c;
-            current_state=STATE_MAKING_MOVE;
-            return;
+        Score_t delta = delta_score(b, c, row, maximizing);
+        if (delta == (maximizing ? SCORE_MAX : SCORE_MIN)) {
+            STATS_SHORTCUT(STATS_IMMEDIATE_WIN);
+            return c;
         }
     }
 
-    Result_t r = minimax(&game_board, MAX_DEPTH, true, SCORE_MIN, SCORE_MAX);
-    Col_t bot_move = r.move;
-    move_to_make = bot_move;
+    // the first moves are read from the opening book in flash instead of searched
+    Move_t book_move;
+    if (Book_lookup(b, maximizing, &book_move)) {
+        STATS_SHORTCUT(STATS_BOOK);
+        return book_move;
+    }
+
+    // the position may have been searched while the human was thinking about the move that led to it
+    Move_t ponder_move;
+    if (maximizing && Ponder_lookup(b, &ponder_move)) {
+        STATS_SHORTCUT(STATS_PONDER);
+        return ponder_move;
+    }
+
+    Result_t r = iterative_deepening(b, maximizing, max_depth, budget_ms);
+    return r.move;
+}
+
+void fn_CALCULATING_MOVE(void) {
+
+    //write the waiting indicator on the display
+    Display_write();
+
+    move_to_make = choose_move(&game_board, true, MAX_DEPTH, SEARCH_BUDGET_MS);
+    STATS_EMIT(game_board.moves, move_to_make);
+
+#ifndef NDEBUG
+    // effective branching factor: the b for which a uniform tree as deep as the last completed iteration
+    // has as many nodes as we visited
+    if (search_depth > 0) {
+        printf("search depth %d: %lu nodes, effective branching factor %.2f\n", (int)search_depth,
+               (unsigned long)search_nodes, pow((double)search_nodes, 1.0 / search_depth));
+    }
+#endif
     current_state=STATE_MAKING_MOVE;
 }
 
 
 GameState_t Game_winner(Score_t delta) {
-    if (delta >= 95) {
+    if (delta == SCORE_MAX) {
         return GAME_COMPUTER_WON;
     }
-    if (delta <= -95) {
+    if (delta == SCORE_MIN) {
         return GAME_PLAYER_WON;
     }
     if (Board_full(&game_board)) {
@@ -1,9 +1,93 @@
-#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
-#include "LcdDriver/Crystalfontz128x128_ST7735.h"
 #include "include/displaycontroller.h"
 #include "include/board.h"
 #include "include/sensorsdriver.h"
 #include "include/connect4algorithm.h"
+#include "include/hal.h"
+#include "include/statusbitmaps.h"
+#include "string.h"
+
+/* layout of the game screen, in pixels
+ * the status line is at the top, below it the strip where the column of the computer's move is marked, then the
+ * board: a blue grid of 16x16 cells with a hole in each, and the column numbers under it.
+ * the rows of the board are counted from the bottom, like in Board_t
+ */
+#define STATUS_HEIGHT   10
+#define MARKER_Y        12
+#define MARKER_HEIGHT   5
+#define BOARD_X         8
+#define BOARD_Y         20
+#define CELL_SIZE       16
+#define DISC_RADIUS     6
+#define NUMBERS_Y       (BOARD_Y + NUM_ROWS * CELL_SIZE + 6)
+
+// center of the cell of a column and a row
+#define CELL_X(col)     (BOARD_X + (col) * CELL_SIZE + CELL_SIZE / 2)
+#define CELL_Y(row)     (BOARD_Y + (NUM_ROWS - 1 - (row)) * CELL_SIZE + CELL_SIZE / 2)
+
+// the longest status message with a column number and the terminator
+#define STATUS_TEXT_SIZE 24
+
+// what is on the display: whether the empty board has been drawn, how many discs of every column have been drawn on
+// it, and the column that is marked (NUM_COLS for none)
+static bool board_shown;
+static uint8_t shown_height[NUM_COLS];
+static Col_t shown_marker = NUM_COLS;
+
+#ifdef HOST_BUILD
+// writes the text of a status message in text, followed by the number of column unless it is NUM_COLS
+// the host records it in place of the bitmaps
+static void status_text(char text[STATUS_TEXT_SIZE], StatusMessage_t message, Col_t column){
+    size_t length = strlen(STATUS_TEXTS[message]);
+
+    memcpy(text, STATUS_TEXTS[message], length);
+    if (column < NUM_COLS) text[length++] = (char)('1' + column);
+    text[length] = '\0';
+}
+#endif
+
+#if defined(HOST_BUILD) && !defined(HOST_LCD)
+
+// the host has no LCD and no graphics library: the text that would be drawn is recorded by the HAL, the board is not
+// drawn. with HOST_LCD the code below runs on the host too, with the graphics library built for the host and the
+// emulator of the LCD controller of the host HAL
+
+void Display_init(void){
+    Display_write();
+}
+
+void Display_clear(void){
+    board_shown = false;
+}
+
+void Display_printCentered(char *text){
+    board_shown = false;
+    HAL_host_display(text);
+}
+
+void Display_status(StatusMessage_t message, Col_t column){
+    char text[STATUS_TEXT_SIZE];
+
+    status_text(text, message, column);
+    HAL_host_display(text);
+}
+
+static void draw_grid(void){
+}
+
+static void draw_disc(Col_t col, Row_t row, bool is_computer){
+    (void)col;
+    (void)row;
+    (void)is_computer;
+}
+
+static void draw_marker(Col_t col, bool on){
+    (void)col;
+    (void)on;
+}
+
+#else
+
+#include "LcdDriver/Crystalfontz128x128_ST7735.h"
 
 // graphics context used for all drawing on the LCD
 Graphics_Context g_sContext;
@@ -32,6 +116,7 @@ void Display_init(void){
 
 // helper function to clear the entire display
 void Display_clear(void){
+    board_shown = false;
     Graphics_clearDisplay(&g_sContext);
 }
 
@@ -45,37 +130,157 @@ void Display_printCentered(char *text){
                                 64,
                                 64,
                                 OPAQUE_TEXT);
+
+    // with the framebuffer of the LCD driver only the pixels that changed are sent to the display
+    Graphics_flushBuffer(&g_sContext);
+#ifdef HOST_BUILD
+    HAL_host_display(text);
+#endif
+}
+
+// function to write a message on the status line above the board, the rest of the screen is left as it is
+// the message is a bitmap rendered offline (include/statusbitmaps.h), followed by the digit of column if it is not
+// NUM_COLS, and drawn centered on the line with the blit of the LCD driver, a single window per bitmap
+void Display_status(StatusMessage_t message, Col_t column){
+    const StatusBitmap_t *bitmap = &STATUS_MESSAGES[message];
+    int16_t width = bitmap->width + (column < NUM_COLS ? STATUS_DIGITS[0].width : 0);
+    int16_t x = 64 - width / 2;
+    int16_t y = (STATUS_HEIGHT - STATUS_BITMAP_HEIGHT) / 2;
+
+    // the bitmaps paint their own background, only the rest of the line is cleared, so that the pixels of the
+    // letters that stay the same do not change and are not sent again
+    Graphics_Rectangle left = {0, 0, x - 1, STATUS_HEIGHT - 1};
+    Graphics_Rectangle right = {x + width, 0, LCD_HORIZONTAL_MAX - 1, STATUS_HEIGHT - 1};
+
+    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_BLACK);
+    if (left.sXMax >= left.sXMin) Graphics_fillRectangle(&g_sContext, &left);
+    if (right.sXMax >= right.sXMin) Graphics_fillRectangle(&g_sContext, &right);
+    Crystalfontz128x128_DrawBitmap(x, y, bitmap->width, STATUS_BITMAP_HEIGHT, bitmap->bits,
+                                   GRAPHICS_COLOR_WHITE, GRAPHICS_COLOR_BLACK);
+    if (column < NUM_COLS) {
+        Crystalfontz128x128_DrawBitmap(x + bitmap->width, y, STATUS_DIGITS[column].width, STATUS_BITMAP_HEIGHT,
+                                       STATUS_DIGITS[column].bits, GRAPHICS_COLOR_WHITE, GRAPHICS_COLOR_BLACK);
+    }
+
+    // the board drawn before the status line is sent with it
+    Graphics_flushBuffer(&g_sContext);
+#ifdef HOST_BUILD
+    {
+        char text[STATUS_TEXT_SIZE];
+        status_text(text, message, column);
+        HAL_host_display(text);
+    }
+#endif
+}
+
+// draws the empty board on a clear screen: the grid with its holes and the column numbers
+static void draw_grid(void){
+    Graphics_Rectangle grid = {BOARD_X, BOARD_Y, BOARD_X + NUM_COLS * CELL_SIZE - 1, BOARD_Y + NUM_ROWS * CELL_SIZE - 1};
+    char number[2] = "1";
+    Col_t c;
+    Row_t r;
+
+    Display_clear();
+    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_BLUE);
+    Graphics_fillRectangle(&g_sContext, &grid);
+    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_BLACK);
+    for (c = 0; c < NUM_COLS; c++) {
+        for (r = 0; r < NUM_ROWS; r++) {
+            Graphics_fillCircle(&g_sContext, CELL_X(c), CELL_Y(r), DISC_RADIUS);
+        }
+    }
+
+    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
+    for (c = 0; c < NUM_COLS; c++) {
+        number[0] = '1' + c;
+        Graphics_drawStringCentered(&g_sContext, (int8_t *)number, 1, CELL_X(c), NUMBERS_Y, OPAQUE_TEXT);
+    }
+}
+
+// draws a disc in its hole, red for the computer and yellow for the player
+static void draw_disc(Col_t col, Row_t row, bool is_computer){
+    Graphics_setForegroundColor(&g_sContext, is_computer ? GRAPHICS_COLOR_RED : GRAPHICS_COLOR_YELLOW);
+    Graphics_fillCircle(&g_sContext, CELL_X(col), CELL_Y(row), DISC_RADIUS);
+}
+
+// draws (on) or erases the mark above a column
+static void draw_marker(Col_t col, bool on){
+    Graphics_Rectangle mark = {CELL_X(col) - DISC_RADIUS, MARKER_Y, CELL_X(col) + DISC_RADIUS,
+                               MARKER_Y + MARKER_HEIGHT - 1};
+
+    Graphics_setForegroundColor(&g_sContext, on ? GRAPHICS_COLOR_RED : GRAPHICS_COLOR_BLACK);
+    Graphics_fillRectangle(&g_sContext, &mark);
+}
+
+#endif
+
+// function that brings the board on the display up to date with game_board
+// the empty board is drawn once, then only the discs added since the last call are drawn. a board with fewer discs
+// than the display, i.e. a new game, or a screen cleared by Display_printCentered() is drawn again from the start
+void Display_board(void){
+    Col_t c;
+    Row_t r;
+
+    for (c = 0; c < NUM_COLS && board_shown; c++) {
+        if (game_board.height[c] < shown_height[c]) board_shown = false;
+    }
+    if (!board_shown) {
+        draw_grid();
+        for (c = 0; c < NUM_COLS; c++) shown_height[c] = 0;
+        shown_marker = NUM_COLS;
+        board_shown = true;
+    }
+
+    for (c = 0; c < NUM_COLS; c++) {
+        for (r = shown_height[c]; r < game_board.height[c]; r++) {
+            draw_disc(c, r, (game_board.p1[c] >> r) & 1);
+        }
+        shown_height[c] = game_board.height[c];
+    }
+}
+
+// function that marks a column above the board, NUM_COLS removes the mark
+// only the old and the new mark are drawn
+void Display_highlight(Col_t col){
+    if (col == shown_marker) return;
+    if (shown_marker < NUM_COLS) draw_marker(shown_marker, false);
+    if (col < NUM_COLS) draw_marker(col, true);
+    shown_marker = col;
+}
+
+// function that shows the board with a message on the status line, the computer's column is marked while it waits
+// for the player to make its move
+static void show_board(StatusMessage_t message, Col_t column){
+    Display_board();
+    Display_highlight(current_state == STATE_MAKING_MOVE ? move_to_make : NUM_COLS);
+    Display_status(message, column);
 }
 
 // function that updates the display based on the current state of the game
 // shows messages like "Initializing", "Your move", or the move made by the computer
+// during the game the message is on the status line above the board, only what changed since the last call is drawn
 void Display_write(){
     switch (current_state) {
         case STATE_INIT:
             Display_printCentered("Initializing");
             break;
         case STATE_WAITING_FOR_MOVE:
-            Display_printCentered("Your move: Yellow");
+            show_board(STATUS_YOUR_MOVE, NUM_COLS);
             break;
         case STATE_CALCULATING_MOVE:
-            Display_printCentered("Calculating Move");
+            show_board(STATUS_CALCULATING, NUM_COLS);
             break;
         case STATE_MAKING_MOVE:
-        {
-            char buffer[16] = "Red moves to: ";
-            buffer[14] = '0' + (move_to_make + 1);
-            buffer[15] = '\0';
-            Display_printCentered(buffer);
+            show_board(STATUS_RED_MOVES_TO, move_to_make);
             break;
-        }
         case STATE_PLAYER_VICTORY:
-            Display_printCentered("You WON! :D");
+            show_board(STATUS_YOU_WON, NUM_COLS);
             break;
         case STATE_COMPUTER_VICTORY:
-            Display_printCentered("You Lost :(");
+            show_board(STATUS_YOU_LOST, NUM_COLS);
             break;
         case STATE_DRAW:
-            Display_printCentered("Draw");
+            show_board(STATUS_DRAW, NUM_COLS);
             break;
     }
 }
@@ -5,7 +5,6 @@
  */
 
 
-#include "msp.h"
 #include "include/types.h"
 #include <stdbool.h>
 
@@ -21,6 +20,12 @@ State_t current_state = STATE_INIT;
 //variable that holds the current state of the game board, must be initialized with Board_init() before use
 Board_t game_board;
 
+// search depth used by the algorithm, chosen in the start menu by fn_INIT
+volatile uint8_t MAX_DEPTH;
+
+// wall-clock budget of a search in milliseconds, chosen together with MAX_DEPTH by fn_INIT
+volatile uint16_t SEARCH_BUDGET_MS;
+
 // variables used as flags for when the pushbutton 1 and 2 on the boosterpack have been pressed
 volatile bool button1_pressed=false;
 volatile bool button2_pressed=false;
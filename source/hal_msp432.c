@@ -0,0 +1,416 @@
+/*
+ * hal_msp432.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/* MSP432 backend of the hardware abstraction layer, see include/hal.h
+ * this file also contains the interrupt service routines of the GPIO ports, which used to live in interrupts.c
+ */
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include "LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h"
+#include "include/hal.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+// type to hold where an input is connected
+typedef struct{
+    uint_fast8_t port;
+    uint_fast16_t pin;
+} Pin_t;
+
+// pins of the inputs, in HAL_Input_t order
+// next to them are the pins they correspond to on the boosterpack
+static const Pin_t INPUT_PINS[HAL_NUM_INPUTS] = {
+    {GPIO_PORT_P3, GPIO_PIN6},  // sensor column 1, J2.11
+    {GPIO_PORT_P3, GPIO_PIN0},  // sensor column 2, J2.18
+    {GPIO_PORT_P5, GPIO_PIN2},  // sensor column 3, J2.12
+    {GPIO_PORT_P6, GPIO_PIN6},  // sensor column 4, J4.36
+    {GPIO_PORT_P6, GPIO_PIN7},  // sensor column 5, J4.35
+    {GPIO_PORT_P2, GPIO_PIN3},  // sensor column 6, J4.34
+    {GPIO_PORT_P4, GPIO_PIN6},  // sensor column 7, J1.8
+    {GPIO_PORT_P5, GPIO_PIN1},  // button 1
+    {GPIO_PORT_P3, GPIO_PIN5},  // button 2
+};
+
+// pins of the LCD control lines, in HAL_LcdPin_t order
+static const Pin_t LCD_PINS[] = {
+    {LCD_RST_PORT, LCD_RST_PIN},
+    {LCD_DC_PORT, LCD_DC_PIN},
+    {LCD_CS_PORT, LCD_CS_PIN},
+};
+
+static volatile HAL_InputHandler_t handlers[HAL_NUM_INPUTS];
+
+/* asynchronous SPI transfers: uDMA channel 0 moves the bytes to the transmit buffer of eUSCI_B0, triggered by its
+ * transmit interrupt flag. the flag only triggers the DMA when it rises, so the first byte is written by the CPU and
+ * the DMA sends the others as the flag rises after each byte. the DMA interrupt comes when the DMA has written the
+ * last byte, the handler waits for it to leave the bus before calling the done handler of the transfer
+ */
+#define SPI_DMA_CHANNEL 0
+
+// control table of the DMA, its address must be aligned on its size (1 KB with the alternate structures)
+#if defined(__TI_COMPILER_VERSION__)
+#pragma DATA_ALIGN(dma_control_table, 1024)
+static DMA_ControlTable dma_control_table[32];
+#else
+static DMA_ControlTable dma_control_table[32] __attribute__((aligned(1024)));
+#endif
+
+static volatile bool spi_busy;
+static volatile HAL_SpiDoneHandler_t spi_done;
+
+// bounds of the stack, defined by the linker: its size is set in the linker options of the CCS project (see README.md)
+#if defined(__TI_COMPILER_VERSION__)
+extern uint32_t __stack;
+extern uint32_t __STACK_END;
+#define STACK_BOTTOM (&__stack)
+#define STACK_TOP    (&__STACK_END)
+#else
+extern uint32_t __StackLimit;
+extern uint32_t __StackTop;
+#define STACK_BOTTOM (&__StackLimit)
+#define STACK_TOP    (&__StackTop)
+#endif
+
+// pattern of the stack words that were never used
+#define STACK_PAINT 0xC4C4C4C4u
+
+// number of Timer32 ticks in a millisecond, depends on the MCLK frequency set at the time of HAL_timer_init()
+static uint32_t ticks_per_ms;
+
+// fills the stack below the frame of the caller with STACK_PAINT, leaving some words for this function's own frame
+static void paint_stack(void){
+    volatile uint32_t here;
+    uint32_t *p;
+    for (p = STACK_BOTTOM; p < (uint32_t *)&here - 16; p++) *p = STACK_PAINT;
+}
+
+void HAL_init(void){
+    WDT_A->CTL = WDT_A_CTL_PW | WDT_A_CTL_HOLD;     // stop watchdog timer
+    paint_stack();
+
+    // the delays count Timer32 ticks, so the counter runs from the start
+    HAL_timer_init();
+
+    //enable the interrupts of the gpio ports the inputs are on, the most convenient way to do this is by hardcoding the interrupt numbers
+    Interrupt_enableInterrupt(INT_PORT2);
+    Interrupt_enableInterrupt(INT_PORT3);
+    Interrupt_enableInterrupt(INT_PORT4);
+    Interrupt_enableInterrupt(INT_PORT5);
+    Interrupt_enableInterrupt(INT_PORT6);
+    Interrupt_enableMaster();
+}
+
+void HAL_input_init(HAL_Input_t input){
+    // the sensors (tcrt5000) and the buttons pull the pin low when they are active
+    GPIO_setAsInputPinWithPullUpResistor(INPUT_PINS[input].port, INPUT_PINS[input].pin);
+    GPIO_interruptEdgeSelect(INPUT_PINS[input].port, INPUT_PINS[input].pin, GPIO_HIGH_TO_LOW_TRANSITION);
+    GPIO_disableInterrupt(INPUT_PINS[input].port, INPUT_PINS[input].pin);
+}
+
+void HAL_input_set_handler(HAL_Input_t input, HAL_InputHandler_t handler){
+    handlers[input] = handler;
+}
+
+void HAL_input_enable(HAL_Input_t input){
+    GPIO_clearInterruptFlag(INPUT_PINS[input].port, INPUT_PINS[input].pin);
+    GPIO_enableInterrupt(INPUT_PINS[input].port, INPUT_PINS[input].pin);
+}
+
+void HAL_input_disable(HAL_Input_t input){
+    GPIO_disableInterrupt(INPUT_PINS[input].port, INPUT_PINS[input].pin);
+}
+
+void HAL_sleep(void){
+    PCM_gotoLPM0();
+}
+
+void HAL_sleep_until(const volatile bool *flag){
+    // with the interrupts masked a pending interrupt still ends the sleep, and is served once they are enabled again.
+    // any interrupt ends it, e.g. the end of an SPI DMA transfer, so sleep again until the handler sets the flag
+    Interrupt_disableMaster();
+    while (!*flag) {
+        PCM_gotoLPM0();
+        Interrupt_enableMaster();
+        Interrupt_disableMaster();
+    }
+    Interrupt_enableMaster();
+}
+
+uint32_t HAL_stack_peak(void){
+    // the stack grows down from STACK_TOP, the interrupts use it too
+    const uint32_t *p = STACK_BOTTOM;
+    while (p < STACK_TOP && *p == STACK_PAINT) p++;
+    return (uint32_t)((const uint8_t *)STACK_TOP - (const uint8_t *)p);
+}
+
+bool HAL_input_pending(void){
+    // the port interrupt service routines call the handlers at once, nothing is left waiting for HAL_sleep()
+    return false;
+}
+
+// the delays wait on the Timer32 counter rather than with __delay_cycles(), which only takes a constant and whose
+// duration depends on MCLK. a delay waits one tick more than asked, so it is never shorter
+void HAL_delay_us(uint32_t us){
+    uint32_t ticks = (uint32_t)(((uint64_t)us * ticks_per_ms + 999) / 1000) + 1;
+    uint32_t start = HAL_timer_now();
+    while (HAL_timer_now() - start < ticks);
+}
+
+void HAL_delay_ms(uint32_t ms){
+    uint32_t ticks = ms * ticks_per_ms + 1;
+    uint32_t start = HAL_timer_now();
+    while (HAL_timer_now() - start < ticks);
+}
+
+void HAL_timer_init(void){
+    ticks_per_ms = CS_getMCLK() / 16 / 1000;
+    if (ticks_per_ms == 0) ticks_per_ms = 1;
+
+    // Timer32 counts down from 0xFFFFFFFF and wraps around in free run mode
+    Timer32_initModule(TIMER32_0_BASE, TIMER32_PRESCALER_16, TIMER32_32BIT, TIMER32_FREE_RUN_MODE);
+    Timer32_startTimer(TIMER32_0_BASE, false);
+}
+
+uint32_t HAL_timer_now(void){
+    // invert the count so that time goes up
+    return ~Timer32_getValue(TIMER32_0_BASE);
+}
+
+uint32_t HAL_timer_ticks_per_ms(void){
+    return ticks_per_ms;
+}
+
+void HAL_lcd_port_init(void){
+    // LCD_SCK
+    GPIO_setAsPeripheralModuleFunctionOutputPin(LCD_SCK_PORT, LCD_SCK_PIN, LCD_SCK_PIN_FUNCTION);
+    // LCD_MOSI
+    GPIO_setAsPeripheralModuleFunctionOutputPin(LCD_MOSI_PORT, LCD_MOSI_PIN, LCD_MOSI_PIN_FUNCTION);
+    // LCD_RST
+    GPIO_setAsOutputPin(LCD_RST_PORT, LCD_RST_PIN);
+    // LCD_RS
+    GPIO_setAsOutputPin(LCD_DC_PORT, LCD_DC_PIN);
+    // LCD_CS
+    GPIO_setAsOutputPin(LCD_CS_PORT, LCD_CS_PIN);
+}
+
+void HAL_spi_init(void){
+    eUSCI_SPI_MasterConfig config =
+        {
+            EUSCI_B_SPI_CLOCKSOURCE_SMCLK,
+            LCD_SYSTEM_CLOCK_SPEED,
+            LCD_SPI_CLOCK_SPEED,
+            EUSCI_B_SPI_MSB_FIRST,
+            EUSCI_B_SPI_PHASE_DATA_CAPTURED_ONFIRST_CHANGED_ON_NEXT,
+            EUSCI_B_SPI_CLOCKPOLARITY_INACTIVITY_LOW,
+            EUSCI_B_SPI_3PIN
+        };
+    SPI_initMaster(LCD_EUSCI_BASE, &config);
+    SPI_enableModule(LCD_EUSCI_BASE);
+
+    // DMA channel of the transmit buffer, 8-bit items from an incrementing source to the fixed transmit buffer
+    DMA_enableModule();
+    DMA_setControlBase(dma_control_table);
+    DMA_assignChannel(DMA_CH0_EUSCIB0TX0);
+    DMA_disableChannelAttribute(DMA_CH0_EUSCIB0TX0,
+                                UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    DMA_setChannelControl(UDMA_PRI_SELECT | DMA_CH0_EUSCIB0TX0, UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    DMA_assignInterrupt(DMA_INT1, SPI_DMA_CHANNEL);
+    DMA_clearInterruptFlag(SPI_DMA_CHANNEL);
+    Interrupt_enableInterrupt(INT_DMA_INT1);
+
+    GPIO_setOutputLowOnPin(LCD_CS_PORT, LCD_CS_PIN);
+
+    GPIO_setOutputHighOnPin(LCD_DC_PORT, LCD_DC_PIN);
+}
+
+void HAL_spi_write(uint8_t data){
+    HAL_spi_wait();
+
+    // USCI_B0 Busy? //
+    while (UCB0STATW & UCBUSY);
+
+    // Transmit data
+    UCB0TXBUF = data;
+
+    // USCI_B0 Busy? //
+    while (UCB0STATW & UCBUSY);
+}
+
+// the blocks only wait for room in the transmit buffer before each byte, the shift register sends the previous one
+// meanwhile. eUSCI_B has no 16-bit frames, a pixel is two 8-bit frames
+static inline void spi_put(uint8_t data){
+    while (!(UCB0IFG & UCTXIFG));
+    UCB0TXBUF = data;
+}
+
+void HAL_spi_write_pixels(const uint16_t *pixels, uint32_t count){
+    HAL_spi_wait();
+    while (count--) {
+        uint16_t pixel = *pixels++;
+        spi_put((uint8_t)(pixel >> 8));
+        spi_put((uint8_t)pixel);
+    }
+    while (UCB0STATW & UCBUSY);
+}
+
+void HAL_spi_fill(uint16_t pixel, uint32_t count){
+    uint8_t high = (uint8_t)(pixel >> 8), low = (uint8_t)pixel;
+    HAL_spi_wait();
+    while (count--) {
+        spi_put(high);
+        spi_put(low);
+    }
+    while (UCB0STATW & UCBUSY);
+}
+
+void HAL_spi_write_async(const uint8_t *data, uint16_t length, HAL_SpiDoneHandler_t done){
+    HAL_spi_wait();
+    spi_done = done;
+    spi_busy = true;
+
+    while (UCB0STATW & UCBUSY);
+    if (length > 1) {
+        DMA_setChannelTransfer(UDMA_PRI_SELECT | DMA_CH0_EUSCIB0TX0, UDMA_MODE_BASIC, (void *)(data + 1),
+                               (void *)SPI_getTransmitBufferAddressForDMA(LCD_EUSCI_BASE), length - 1);
+        DMA_enableChannel(SPI_DMA_CHANNEL);
+    }
+    UCB0TXBUF = data[0];
+
+    // with a single byte there is no DMA transfer, the interrupt is raised by hand to end it the same way
+    if (length == 1) Interrupt_pendInterrupt(INT_DMA_INT1);
+}
+
+void HAL_spi_wait(void){
+    while (spi_busy);
+}
+
+void HAL_lcd_set_pin(HAL_LcdPin_t pin, bool high){
+    HAL_spi_wait();
+    if (high) GPIO_setOutputHighOnPin(LCD_PINS[pin].port, LCD_PINS[pin].pin);
+    else GPIO_setOutputLowOnPin(LCD_PINS[pin].port, LCD_PINS[pin].pin);
+}
+
+
+/* telemetry over the UART of the XDS110 backchannel: eUSCI_A0 on P1.2 (RX) and P1.3 (TX), 115200 baud 8N1, it shows
+ * up on the PC as the "Application/User UART" serial port of the LaunchPad.
+ * the baud rate registers are computed from the SMCLK frequency like in the family user's guide (section 24.3.10),
+ * so that they stay right if the clock system is configured later
+ */
+#define TELEMETRY_BAUD 115200
+
+// fractional part of the divider in 1/10000, and the UCBRSx modulation pattern used from there on
+// table 24-4 of the family user's guide
+static const struct {
+    uint16_t fraction;
+    uint8_t pattern;
+} UCBRS_TABLE[] = {
+    {0, 0x00}, {529, 0x01}, {715, 0x02}, {835, 0x04}, {1001, 0x08}, {1252, 0x10}, {1430, 0x20}, {1670, 0x11},
+    {2147, 0x21}, {2224, 0x22}, {2503, 0x44}, {3000, 0x25}, {3335, 0x49}, {3575, 0x4A}, {3753, 0x52}, {4003, 0x92},
+    {4286, 0x53}, {4378, 0x55}, {5002, 0xAA}, {5715, 0x6B}, {6003, 0xAD}, {6254, 0xB5}, {6432, 0xB6}, {6667, 0xD6},
+    {7001, 0xB7}, {7147, 0xBB}, {7503, 0xDD}, {7861, 0xED}, {8004, 0xEE}, {8333, 0xBF}, {8464, 0xDF}, {8572, 0xEF},
+    {8751, 0xF7}, {9004, 0xFB}, {9170, 0xFD}, {9288, 0xFE},
+};
+
+static bool telemetry_ready;
+
+void HAL_telemetry_init(void){
+    uint32_t clock = CS_getSMCLK();
+    // N = clock / baud, kept in 1/10000 to pick the modulation pattern
+    uint32_t n_int = clock / TELEMETRY_BAUD;
+    uint32_t n_frac = (uint32_t)(((uint64_t)(clock % TELEMETRY_BAUD) * 10000) / TELEMETRY_BAUD);
+    uint8_t pattern = 0;
+    int i;
+
+    if (telemetry_ready) return;
+
+    for (i = 0; i < (int)(sizeof(UCBRS_TABLE) / sizeof(UCBRS_TABLE[0])); i++) {
+        if (UCBRS_TABLE[i].fraction <= n_frac) pattern = UCBRS_TABLE[i].pattern;
+    }
+
+    eUSCI_UART_ConfigV1 config =
+        {
+            EUSCI_A_UART_CLOCKSOURCE_SMCLK,
+            0,
+            0,
+            pattern,
+            EUSCI_A_UART_NO_PARITY,
+            EUSCI_A_UART_LSB_FIRST,
+            EUSCI_A_UART_ONE_STOP_BIT,
+            EUSCI_A_UART_MODE,
+            EUSCI_A_UART_LOW_FREQUENCY_BAUDRATE_GENERATION,
+            EUSCI_A_UART_8_BIT_LEN
+        };
+    if (n_int >= 16) {
+        // oversampling: UCBRx = INT(N / 16), UCBRFx = INT((N / 16 - INT(N / 16)) * 16)
+        config.clockPrescalar = n_int / 16;
+        config.firstModReg = (uint_fast8_t)(n_int % 16);
+        config.overSampling = EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION;
+    }
+    else {
+        config.clockPrescalar = n_int;
+    }
+
+    GPIO_setAsPeripheralModuleFunctionOutputPin(GPIO_PORT_P1, GPIO_PIN2 | GPIO_PIN3, GPIO_PRIMARY_MODULE_FUNCTION);
+    UART_initModule(EUSCI_A0_BASE, &config);
+    UART_enableModule(EUSCI_A0_BASE);
+    telemetry_ready = true;
+}
+
+void HAL_telemetry_write(const uint8_t *data, uint16_t length){
+    uint16_t i;
+    if (!telemetry_ready) return;
+    // UART_transmitData() waits for the transmit buffer to be free before writing each byte
+    for (i = 0; i < length; i++) UART_transmitData(EUSCI_A0_BASE, data[i]);
+}
+
+/* interrupt service routines of the ports the inputs are on
+ * every input that triggers calls the handler registered for it. the handlers of the sensors disable the other sensors,
+ * so that only one move is detected per wake up: only the first input found in the status of the port is served
+ */
+static void process_port_interrupt(uint_fast8_t port){
+    uint_fast16_t status = GPIO_getEnabledInterruptStatus(port);
+    GPIO_clearInterruptFlag(port, status);
+
+    int i;
+    for(i=0;i<HAL_NUM_INPUTS;i++){
+        if(INPUT_PINS[i].port == port && (status & INPUT_PINS[i].pin)){
+            if(handlers[i]) handlers[i]((HAL_Input_t)i);
+            break;
+        }
+    }
+}
+
+// end of an asynchronous SPI transfer
+void DMA_INT1_IRQHandler(void){
+    HAL_SpiDoneHandler_t done = spi_done;
+
+    DMA_clearInterruptFlag(SPI_DMA_CHANNEL);
+    while (UCB0STATW & UCBUSY);
+
+    spi_done = NULL;
+    spi_busy = false;
+    if (done) done();
+}
+
+void PORT2_IRQHandler(void){
+    process_port_interrupt(GPIO_PORT_P2);
+}
+
+void PORT3_IRQHandler(void){
+    process_port_interrupt(GPIO_PORT_P3);
+}
+
+void PORT4_IRQHandler(void){
+    process_port_interrupt(GPIO_PORT_P4);
+}
+
+void PORT5_IRQHandler(void){
+    process_port_interrupt(GPIO_PORT_P5);
+}
+
+void PORT6_IRQHandler(void){
+    process_port_interrupt(GPIO_PORT_P6);
+}
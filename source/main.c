@@ -1,11 +1,18 @@
-#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include "include/hal.h"
 #include "include/board.h"
 #include "include/displaycontroller.h"
 #include "include/connect4algorithm.h"
 #include "include/sensorsdriver.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/timer.h"
+#include "include/searchstats.h"
+#include "include/stateprofile.h"
+#include "include/ponder.h"
 #include "include/types.h"
 #include<stdbool.h>
-#include "msp.h"
+#include<string.h>
+#include<stdio.h>
 
 
 
@@ -30,13 +37,22 @@ StateMachine_t fsm[] = {
 };
 
 
+// on the host the firmware is a regular process, see host/source/hal_host.c
+#ifdef HOST_BUILD
+int main(void)
+#else
 void main(void)
+#endif
 {
-    WDT_A->CTL = WDT_A_CTL_PW | WDT_A_CTL_HOLD;     // stop watchdog timer
+    HAL_init();
 
     while(1){
         if(current_state < NUM_STATES){
-            (*fsm[current_state].state_function)();
+            // the state function may change current_state, the time is counted for the state that ran
+            State_t state = current_state;
+            Profile_enter(state);
+            (*fsm[state].state_function)();
+            Profile_exit(state);
         }
         else{
             /* serious error */
@@ -50,27 +66,48 @@ extern volatile bool button1_pressed; // button 1 used to change selection in th
 extern volatile bool button2_pressed; // button 2 used to get out of the menu once a selection is made
 extern volatile uint8_t MAX_DEPTH;
 
+// set by the handler of the buttons when either of them is pressed
+static volatile bool button_event;
+
+// HAL handler of the buttons, it sets the flag of the button that was pressed
+static void button_pressed(HAL_Input_t input){
+    if(input == HAL_INPUT_BUTTON1) button1_pressed=true;
+    else button2_pressed=true;
+    button_event=true;
+}
+
+// enables the button interrupts and goes to sleep until one of them is pressed
+// other interrupts, e.g. the DMA of the display, only wake us up: we sleep again until a button sets button_event
+static void wait_for_buttons(void){
+    button_event=false;
+    HAL_input_enable(HAL_INPUT_BUTTON1);
+    HAL_input_enable(HAL_INPUT_BUTTON2);
+    HAL_sleep_until(&button_event);
+
+    //disable the button interrupts so they dont trigger while the display is writing
+    //also to make sure they dont interfere with the sensors during the rest of the program
+    HAL_input_disable(HAL_INPUT_BUTTON1);
+    HAL_input_disable(HAL_INPUT_BUTTON2);
+}
+
 // the fn_INIT function handles the game's start menu, during which the difficulty and the first to play are determined
 // to do this we use the boosterpack's pushbutton 1 and 2
 void fn_INIT(){
     Sensors_init();
     Display_init();
+    Timer_init();
+    HAL_telemetry_init();
     Board_init(&game_board);
+    TT_clear();
+    MoveOrder_clear();
+    Ponder_clear();
 
 
     //enable the pins connected to the pushbuttons as input capable of triggering interrupts
-    //button 1
-    GPIO_setAsInputPinWithPullUpResistor(GPIO_PORT_P5, GPIO_PIN1);
-    GPIO_interruptEdgeSelect(GPIO_PORT_P5, GPIO_PIN1, GPIO_HIGH_TO_LOW_TRANSITION);
-
-    //button 2
-    GPIO_setAsInputPinWithPullUpResistor(GPIO_PORT_P3, GPIO_PIN5);
-    GPIO_interruptEdgeSelect(GPIO_PORT_P3, GPIO_PIN5, GPIO_HIGH_TO_LOW_TRANSITION);
-
-
-    //enable interrputs on ports 3 and 5 in case they aren't enabled already
-    Interrupt_enableInterrupt(INT_PORT3);
-    Interrupt_enableInterrupt(INT_PORT5);
+    HAL_input_init(HAL_INPUT_BUTTON1);
+    HAL_input_init(HAL_INPUT_BUTTON2);
+    HAL_input_set_handler(HAL_INPUT_BUTTON1, button_pressed);
+    HAL_input_set_handler(HAL_INPUT_BUTTON2, button_pressed);
 
 
     // first selection: search depth used by the algorithm, button 1 makes it cycle between 2 4 6
@@ -87,21 +124,21 @@ void fn_INIT(){
 
         button1_pressed=false;
         //enable the button interrupts and go to sleep
-        GPIO_clearInterruptFlag(GPIO_PORT_P5, GPIO_PIN1);
-        GPIO_clearInterruptFlag(GPIO_PORT_P3, GPIO_PIN5);
-        GPIO_enableInterrupt(GPIO_PORT_P5, GPIO_PIN1);
-        GPIO_enableInterrupt(GPIO_PORT_P3, GPIO_PIN5);
-        PCM_gotoLPM0();
+        wait_for_buttons();
 
         // check if the interrupt what woke us up was button 1 being pressed
         if(button1_pressed){
             MAX_DEPTH+=2;
             if(MAX_DEPTH==8) MAX_DEPTH=2;
         }
+    }
 
-        //disable the button interrupts so they dont trigger while the display is writing
-        GPIO_disableInterrupt(GPIO_PORT_P5, GPIO_PIN1);
-        GPIO_disableInterrupt(GPIO_PORT_P3, GPIO_PIN5);
+    // the difficulty also decides how long the algorithm may think about a move
+    Profile_set_level((ProfileLevel_t)(MAX_DEPTH/2 - 1));
+    switch(MAX_DEPTH){
+        case 2: SEARCH_BUDGET_MS=BUDGET_EASY_MS; break;
+        case 4: SEARCH_BUDGET_MS=BUDGET_MEDIUM_MS; break;
+        case 6: SEARCH_BUDGET_MS=BUDGET_HARD_MS; MAX_DEPTH=HARD_MAX_DEPTH; break;
     }
 
     // second selection: determine who goes first, button 1 changes the value of the next state between STATE_WAINTING_FOR_MOVE and STATE_CALCULATING_MOVE
@@ -118,41 +155,50 @@ void fn_INIT(){
 
         button1_pressed=false;
         //enable the button interrupts and go to sleep
-        GPIO_clearInterruptFlag(GPIO_PORT_P5, GPIO_PIN1);
-        GPIO_clearInterruptFlag(GPIO_PORT_P3, GPIO_PIN5);
-        GPIO_enableInterrupt(GPIO_PORT_P5, GPIO_PIN1);
-        GPIO_enableInterrupt(GPIO_PORT_P3, GPIO_PIN5);
-        PCM_gotoLPM0();
+        wait_for_buttons();
 
         //  check if the interrupt what woke us up was button 1 being pressed
         if(button1_pressed){
             next_state=(next_state==STATE_WAITING_FOR_MOVE) ? STATE_CALCULATING_MOVE : STATE_WAITING_FOR_MOVE;
         }
-
-        //disable the button interrupts so they dont trigger while the display is writing
-        //also to make sure they dont interfere with the sensors during the rest of the program
-        GPIO_disableInterrupt(GPIO_PORT_P5, GPIO_PIN1);
-        GPIO_disableInterrupt(GPIO_PORT_P3, GPIO_PIN5);
     }
 
 
     current_state=next_state;
 }
 
-void fn_PLAYER_VICTORY(){
+// sends a piece of the state profile report to the telemetry sink
+static void write_telemetry(const char *text){
+    HAL_telemetry_write((const uint8_t *)text, (uint16_t)strlen(text));
+}
+
+// the game over screens stay until the board is reset, a button pressed meanwhile sends the state profile report
+// followed by the deepest the stack has been, to check the stack size of the CCS project (see README.md)
+static void game_over(void){
     Display_write();
-    PCM_gotoLPM0();
 
+    button1_pressed=false;
+    button2_pressed=false;
+    wait_for_buttons();
+    if(button1_pressed || button2_pressed){
+        Profile_report(write_telemetry);
+        uint32_t stack=HAL_stack_peak();
+        if(stack){
+            char line[48];
+            snprintf(line, sizeof(line), "stack peak: %lu bytes\n", (unsigned long)stack);
+            write_telemetry(line);
+        }
+    }
 }
 
-void fn_COMPUTER_VICTORY(){
-    Display_write();
-    PCM_gotoLPM0();
+void fn_PLAYER_VICTORY(){
+    game_over();
+}
 
+void fn_COMPUTER_VICTORY(){
+    game_over();
 }
 
 void fn_DRAW(){
-    Display_write();
-    PCM_gotoLPM0();
-
+    game_over();
 }
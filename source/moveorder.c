@@ -0,0 +1,85 @@
+/*
+ * moveorder.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/moveorder.h"
+#include "include/transposition.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+
+// rank of each column in the static center-first order, higher is searched first
+static const uint8_t CENTER_RANK[NUM_COLS] = {0, 2, 4, 6, 5, 3, 1};
+
+// killer moves of every ply, TT_NO_MOVE when the slot is empty
+static THREAD_LOCAL Move_t killers[MAX_PLY][NUM_KILLERS];
+
+// history scores: history[is_computer][column][row]
+static THREAD_LOCAL uint16_t history[2][NUM_COLS][NUM_ROWS];
+
+static void clear_killers(void){
+    memset(killers, TT_NO_MOVE, sizeof(killers));
+}
+
+void MoveOrder_new_search(void){
+    Col_t c;
+    Row_t r;
+    clear_killers();
+    for (c = 0; c < NUM_COLS; c++) {
+        for (r = 0; r < NUM_ROWS; r++) {
+            history[0][c][r] >>= 1;
+            history[1][c][r] >>= 1;
+        }
+    }
+}
+
+void MoveOrder_clear(void){
+    clear_killers();
+    memset(history, 0, sizeof(history));
+}
+
+uint8_t MoveOrder_sort(const Board_t *b, bool maximizing, Move_t pv_move, Move_t tt_move, Move_t moves[NUM_COLS]){
+    uint32_t keys[NUM_COLS];
+    uint8_t num_moves = 0;
+    uint8_t j;
+    Col_t c;
+    const Move_t *ply_killers = killers[b->moves];
+
+    for (c = 0; c < NUM_COLS; c++) {
+        if (b->height[c] >= NUM_ROWS) continue;
+
+        // principal variation move, then table move, then killers, then history and static order
+        uint32_t key;
+        if (c == pv_move) key = UINT32_MAX;
+        else if (c == tt_move) key = UINT32_MAX - 1;
+        else if (c == ply_killers[0]) key = UINT32_MAX - 2;
+        else if (c == ply_killers[1]) key = UINT32_MAX - 3;
+        else key = ((uint32_t)history[maximizing][c][b->height[c]] << 3) | CENTER_RANK[c];
+
+        // insertion sort, there are at most 7 moves
+        for (j = num_moves; j > 0 && keys[j - 1] < key; j--) {
+            keys[j] = keys[j - 1];
+            moves[j] = moves[j - 1];
+        }
+        keys[j] = key;
+        moves[j] = c;
+        num_moves++;
+    }
+    return num_moves;
+}
+
+void MoveOrder_cutoff(const Board_t *b, bool maximizing, Move_t move, int depth){
+    Move_t *ply_killers = killers[b->moves];
+    if (ply_killers[0] != move) {
+        ply_killers[1] = ply_killers[0];
+        ply_killers[0] = move;
+    }
+
+    uint16_t *h = &history[maximizing][move][b->height[move]];
+    uint32_t bonus = (uint32_t)depth * depth;
+    *h = (*h + bonus > UINT16_MAX) ? UINT16_MAX : (uint16_t)(*h + bonus);
+}
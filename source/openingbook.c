@@ -0,0 +1,44 @@
+/*
+ * openingbook.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/openingbook.h"
+#include "include/bitboard.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+uint32_t Book_hash(uint64_t key, uint32_t seed){
+    // splitmix64 finalizer of the key offset by the seed
+    uint64_t h = key + (uint64_t)seed * 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return (uint32_t)(h ^ (h >> 31));
+}
+
+bool Book_lookup(const Board_t *board, bool maximizing, Move_t *move){
+    BitBoard_t b, mirror;
+    uint64_t key, mirror_key;
+    bool mirrored;
+
+    if (board->moves >= BOOK_PLIES) return false;
+
+    BitBoard_from_board(&b, board, maximizing);
+    BitBoard_mirror(&mirror, &b);
+    key = BitBoard_key(&b);
+    mirror_key = BitBoard_key(&mirror);
+    mirrored = mirror_key < key;
+    if (mirrored) key = mirror_key;
+
+    uint32_t h = Book_hash(key, 0);
+    uint8_t displacement = book_displacements[h % BOOK_NUM_BUCKETS];
+    BookEntry_t entry = book_slots[Book_hash(key, (uint32_t)displacement + 1) % BOOK_NUM_SLOTS];
+
+    if (entry == BOOK_EMPTY_SLOT || BOOK_ENTRY_CHECK(entry) != BOOK_CHECK(h)) return false;
+
+    *move = mirrored ? (Move_t)(NUM_COLS - 1 - BOOK_ENTRY_MOVE(entry)) : BOOK_ENTRY_MOVE(entry);
+    return true;
+}
@@ -0,0 +1,118 @@
+/*
+ * ponder.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/ponder.h"
+#include "include/connect4algorithm.h"
+#include "include/board.h"
+#include "include/transposition.h"
+#include "include/moveorder.h"
+#include "include/openingbook.h"
+#include "include/timer.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+
+// a position searched to the end while the human was thinking, and the move found
+typedef struct {
+    Hash_t hash;
+    Move_t move;
+} PonderEntry_t;
+
+// one entry per reply of the human at most
+static PonderEntry_t entries[NUM_COLS];
+static uint8_t num_entries;
+
+void Ponder_clear(void){
+    num_entries = 0;
+}
+
+void Ponder_run(Board_t *b, int max_depth, uint32_t budget_ms, const volatile bool *stop){
+    Move_t order[NUM_COLS];
+    Move_t replies[NUM_COLS];
+    uint32_t spent_ms[NUM_COLS];
+    bool done[NUM_COLS];
+    Move_t tt_move = TT_NO_MOVE;
+    Move_t book_move;
+    TTEntry_t entry;
+    uint8_t num_moves, num_replies, num_searching, i;
+    int depth;
+
+    Ponder_clear();
+
+    // the last search stored the human's best reply when it searched the position after the computer's move
+    if (TT_probe(b->hash, &entry)) tt_move = TT_ENTRY_MOVE(entry);
+    num_moves = MoveOrder_sort(b, false, TT_NO_MOVE, tt_move, order);
+
+    // the replies worth searching
+    num_replies = 0;
+    for (i = 0; i < num_moves; i++) {
+        Col_t c = order[i];
+        Score_t delta = delta_score(b, c, b->height[c], false);
+        if (delta == SCORE_MIN) continue;
+
+        Board_make_move(b, c, false, delta);
+        if (!Board_full(b) && !Book_lookup(b, true, &book_move)) {
+            replies[num_replies] = c;
+            spent_ms[num_replies] = 0;
+            done[num_replies] = false;
+            num_replies++;
+        }
+        Board_unmake_move(b, c, false, delta);
+    }
+
+    // one table generation for all the replies, so that the entries of the first ones are not replaced first
+    const volatile bool *caller_stop = search_stop;
+    uint8_t caller_first_depth = search_first_depth;
+    TT_new_search();
+    search_stop = stop;
+    search_first_depth = 1;
+
+    // the replies are deepened together, one iteration each per round, so that a human who moves early still finds
+    // all of them searched about as deep. each search starts over from depth 1, but the iterations of the previous
+    // rounds are found in the transposition table and only the new one costs time
+    num_searching = num_replies;
+    for (depth = 1; num_searching > 0 && !*stop; depth++) {
+        for (i = 0; i < num_replies && !*stop; i++) {
+            if (done[i]) continue;
+
+            Col_t c = replies[i];
+            Score_t delta = delta_score(b, c, b->height[c], false);
+            Board_make_move(b, c, false, delta);
+
+            Ticks_t start = Timer_now();
+            Result_t r = iterative_deepening(b, true, depth, budget_ms - spent_ms[i]);
+            spent_ms[i] += Timer_ms_since(start);
+
+            // a search cut short by the interrupt is only useful for the entries it left in the table. the others
+            // end like fn_CALCULATING_MOVE() would: at the depth limit, the end of the game, a forced result or
+            // once their share of the time is spent
+            if (!*stop && (depth >= max_depth || search_depth < depth || spent_ms[i] >= budget_ms ||
+                           r.score == SCORE_MAX || r.score == SCORE_MIN)) {
+                entries[num_entries].hash = b->hash;
+                entries[num_entries].move = r.move;
+                num_entries++;
+                done[i] = true;
+                num_searching--;
+            }
+            Board_unmake_move(b, c, false, delta);
+        }
+    }
+
+    search_stop = caller_stop;
+    search_first_depth = caller_first_depth;
+}
+
+bool Ponder_lookup(const Board_t *b, Move_t *move){
+    uint8_t i;
+    for (i = 0; i < num_entries; i++) {
+        if (entries[i].hash == b->hash) {
+            *move = entries[i].move;
+            return true;
+        }
+    }
+    return false;
+}
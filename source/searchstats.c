@@ -0,0 +1,117 @@
+/*
+ * searchstats.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/searchstats.h"
+#include "include/connect4algorithm.h"
+#include "include/hal.h"
+#include "include/timer.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+
+static void put_u32(uint8_t *p, uint32_t value){
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t get_u32(const uint8_t *p){
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint16_t Stats_checksum(const uint8_t *data, uint16_t length){
+    uint16_t sum1 = 0, sum2 = 0;
+    uint16_t i;
+    for (i = 0; i < length; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return (uint16_t)((sum2 << 8) | sum1);
+}
+
+void Stats_encode(uint8_t out[STATS_RECORD_SIZE], const StatsRecord_t *record){
+    uint8_t *p = out + 3;
+    Col_t c;
+
+    out[0] = STATS_SYNC;
+    out[1] = STATS_VERSION;
+    out[2] = STATS_PAYLOAD_SIZE;
+    p[0] = record->ply;
+    p[1] = (uint8_t)record->move;
+    p[2] = record->shortcut;
+    p[3] = record->depth;
+    p[4] = record->max_ply;
+    put_u32(p + 5, record->nodes);
+    put_u32(p + 9, record->leaves);
+    put_u32(p + 13, record->total_us);
+    for (c = 0; c < NUM_COLS; c++) {
+        put_u32(p + 17 + 4 * c, record->cutoffs[c]);
+        put_u32(p + 45 + 4 * c, record->root_us[c]);
+    }
+
+    uint16_t sum = Stats_checksum(p, STATS_PAYLOAD_SIZE);
+    out[3 + STATS_PAYLOAD_SIZE] = (uint8_t)sum;
+    out[4 + STATS_PAYLOAD_SIZE] = (uint8_t)(sum >> 8);
+}
+
+bool Stats_decode(const uint8_t in[STATS_RECORD_SIZE], StatsRecord_t *record){
+    const uint8_t *p = in + 3;
+    Col_t c;
+
+    if (in[0] != STATS_SYNC || in[1] != STATS_VERSION || in[2] != STATS_PAYLOAD_SIZE) return false;
+    uint16_t sum = (uint16_t)(in[3 + STATS_PAYLOAD_SIZE] | (in[4 + STATS_PAYLOAD_SIZE] << 8));
+    if (sum != Stats_checksum(p, STATS_PAYLOAD_SIZE)) return false;
+
+    record->ply = p[0];
+    record->move = (Col_t)p[1];
+    record->shortcut = p[2];
+    record->depth = p[3];
+    record->max_ply = p[4];
+    record->nodes = get_u32(p + 5);
+    record->leaves = get_u32(p + 9);
+    record->total_us = get_u32(p + 13);
+    for (c = 0; c < NUM_COLS; c++) {
+        record->cutoffs[c] = get_u32(p + 17 + 4 * c);
+        record->root_us[c] = get_u32(p + 45 + 4 * c);
+    }
+    return true;
+}
+
+#if SEARCH_STATS
+
+THREAD_LOCAL SearchStats_t search_stats;
+
+void Stats_reset(void){
+    memset(&search_stats, 0, sizeof(search_stats));
+    search_stats.start = Timer_now();
+}
+
+void Stats_emit(uint8_t ply, Col_t move){
+    StatsRecord_t record;
+    uint8_t out[STATS_RECORD_SIZE];
+    Col_t c;
+
+    record.ply = ply;
+    record.move = move;
+    record.shortcut = search_stats.shortcut;
+    record.depth = search_depth;
+    record.max_ply = search_stats.max_ply;
+    record.nodes = search_nodes;
+    record.leaves = search_stats.leaves;
+    record.total_us = Timer_ticks_to_us(Timer_now() - search_stats.start);
+    for (c = 0; c < NUM_COLS; c++) {
+        record.cutoffs[c] = search_stats.cutoffs[c];
+        record.root_us[c] = Timer_ticks_to_us(search_stats.root_ticks[c]);
+    }
+
+    Stats_encode(out, &record);
+    HAL_telemetry_write(out, STATS_RECORD_SIZE);
+}
+
+#endif
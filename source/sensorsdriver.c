@@ -6,57 +6,47 @@
  */
 
 
-#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include "include/hal.h"
 #include "include/board.h"
 #include "include/sensorsdriver.h"
 #include "include/connect4algorithm.h"
 #include "include/displaycontroller.h"
+#include "include/ponder.h"
 #include "stdbool.h"
 
 
 
 
-// type to hold the data of where a proximity sensor is connected
-typedef struct{
-    uint_fast8_t port; //port the sensor is connected to
-    uint_fast16_t pin; //pin the sensor is connected to
-    Col_t column; //column the sensor is on
-} Sensor_t;
-
-//array of the pins all the sensors are connected to
-// next to them are the pins they correspond to on the boosterpack
-const Sensor_t sensors[NUM_COLS] = {
-                             {GPIO_PORT_P3,GPIO_PIN6,COL1}, //J2.11
-                             {GPIO_PORT_P3,GPIO_PIN0,COL2}, //J2.18
-                             {GPIO_PORT_P5,GPIO_PIN2,COL3}, //J2.12
-                             {GPIO_PORT_P6,GPIO_PIN6,COL4}, //J4.36
-                             {GPIO_PORT_P6,GPIO_PIN7,COL5}, //J4.35
-                             {GPIO_PORT_P2,GPIO_PIN3,COL6}, //J4.34
-                             {GPIO_PORT_P4,GPIO_PIN6,COL7}  //J1.8
-};
+// the sensors are the HAL inputs HAL_INPUT_SENSOR(c), one on top of every column c
+// the pins they are connected to are listed in source/hal_msp432.c
 
 // global variable used only in this file that stores in what column a move from the player has been detected
 volatile Move_t move_detected;
 
+// set by the interrupt routine when a sensor has detected a piece: the player's move, which also stops the ponder
+// search, or the piece of the computer requested by Sensors_request_piece()
+static volatile bool move_ready;
+
 
 //function to enable the all interrupts on the sensor pins
 void enable_interrupts();
 //function to disable all the interrupts on the sensor pins
 void disable_interrupts();
-//function that processes an interrupt triggered by a sensor, it gets called by the ISRs that pass it the port the interrupt came from
-void process_interrupt(uint_fast8_t port);
 
 void fn_WAITING_FOR_MOVE(void){
     //write the indicator to let the player move on the display
     Display_write();
 
     //allow the sensors to trigger an interrupt
+    move_ready = false;
     enable_interrupts();
 
-    //go to sleep
-    PCM_gotoLPM0();
+    //search the replies of the player until they move, then go to sleep if they have not moved yet
+    //a move that is already waiting (the host script) would only be seen once the search is over, so there is no pondering
+    if (!HAL_input_pending()) Ponder_run(&game_board, MAX_DEPTH, SEARCH_BUDGET_MS, &move_ready);
+    HAL_sleep_until(&move_ready);
 
-    //when we get out of sleep it means there's been an interrupt, so let's apply the move we detected
+    //when we get out of sleep it means a sensor detected the move, so let's apply it
     int8_t row = game_board.height[move_detected];
     Score_t delta = delta_score(&game_board, move_detected, row, false);
     Board_make_move(&game_board, move_detected, false, delta);
@@ -64,12 +54,10 @@ void fn_WAITING_FOR_MOVE(void){
     //check if the player won and decide the next state
     GameState_t state = Game_winner(delta);
 
-    char buffer[13] = "You chose: ";
-    buffer[11] = '0' + (move_detected + 1);
-    buffer[12] = '\0';
-
-    Display_printCentered(buffer);
-    __delay_cycles(6000000);
+    // leave the move on the display for two seconds (the 6000000 cycles this used to wait at the default 3 MHz MCLK)
+    Display_board();
+    Display_status(STATUS_YOU_CHOSE, move_detected);
+    HAL_delay_ms(2000);
 
     switch (state) {
         case GAME_COMPUTER_WON:
@@ -89,40 +77,21 @@ void fn_WAITING_FOR_MOVE(void){
 
 
 void Sensors_init(void){
-    int i;
-    for(i=0;i<NUM_COLS;i++){
-        // the sensors we use (tcrt5000) output low when they detect something, so we set them to have pullup resistors and to trigger an interrupt when the input gets low
-        GPIO_setAsInputPinWithPullUpResistor(sensors[i].port, sensors[i].pin);
-        GPIO_interruptEdgeSelect(sensors[i].port, sensors[i].pin, GPIO_HIGH_TO_LOW_TRANSITION);
+    Col_t c;
+    for(c=0;c<NUM_COLS;c++){
+        HAL_input_init(HAL_INPUT_SENSOR(c));
+        HAL_input_set_handler(HAL_INPUT_SENSOR(c), Sensors_process_interrupt);
     }
-
-    //enable the interrupts of the gpio ports, the most convenient way to do this is by hardcoding the interrupt numbers
-    Interrupt_enableInterrupt(INT_PORT2);
-    Interrupt_enableInterrupt(INT_PORT3);
-    Interrupt_enableInterrupt(INT_PORT4);
-    Interrupt_enableInterrupt(INT_PORT5);
-    Interrupt_enableInterrupt(INT_PORT6);
-    Interrupt_enableMaster(); //just in case interrupts arent enabled we enable them
 }
 
 
 void Sensors_request_piece(Col_t column){
-    Sensor_t sensor;
+    //enable the interrupt on the sensor of the requested column
+    move_ready = false;
+    HAL_input_enable(HAL_INPUT_SENSOR(column));
 
-    int i;
-    for(i=0;i<NUM_COLS;i++){ // find the sensor that corresponds to the requested column
-        if(sensors[i].column == column){
-            sensor=sensors[i];
-            break;
-        }
-    }
-
-    //enable the interrupt on that sensor
-    GPIO_clearInterruptFlag(sensor.port, sensor.pin);
-    GPIO_enableInterrupt(sensor.port, sensor.pin);
-
-    //go to sleep
-    PCM_gotoLPM0();
+    //go to sleep until the sensor triggers, other interrupts (e.g. the DMA of the display) only wake us up
+    HAL_sleep_until(&move_ready);
 
     //when we exit from sleep it mean the sensor detected a move on the requested column
     return;
@@ -130,23 +99,19 @@ void Sensors_request_piece(Col_t column){
 
 
 void enable_interrupts(){
-    int i;
-    for(i=0;i<NUM_COLS;i++){ //first clear the flags
-        GPIO_clearInterruptFlag(sensors[i].port, sensors[i].pin);
-    }
-
-    for(i=0;i<NUM_COLS;i++){ //then enable the interrupts
-        if(game_board.height[sensors[i].column] >= NUM_ROWS){ // do not enable sensors that are placed on full columns
-            GPIO_enableInterrupt(sensors[i].port, sensors[i].pin);
+    Col_t c;
+    for(c=0;c<NUM_COLS;c++){
+        if(game_board.height[c] < NUM_ROWS){ // do not enable sensors that are placed on full columns
+            HAL_input_enable(HAL_INPUT_SENSOR(c));
         }
     }
 }
 
 
 void disable_interrupts(){
-    int i;
-    for(i=0;i<NUM_COLS;i++){
-        GPIO_disableInterrupt(sensors[i].port, sensors[i].pin);
+    Col_t c;
+    for(c=0;c<NUM_COLS;c++){
+        HAL_input_disable(HAL_INPUT_SENSOR(c));
     }
 }
 
@@ -157,23 +122,10 @@ void disable_interrupts(){
  * we should detect exactly one move for every time fn_WAITING_FOR_MOVE is called, so all the interrupt routines need mutual exclusion to the move_detected variable and to the Board_t variable
  * to do this we make each interrupt routine disable all the sensor interrupts using disable_interrupts(), so that only one routine can happen at a time
  */
-void Sensors_process_interrupt(uint_fast8_t port){
-    /* Check which pins generated the interrupts */
-    uint_fast16_t status = GPIO_getEnabledInterruptStatus(port);
-    /* clear interrupt flag (to clear pending interrupt indicator */
-    GPIO_clearInterruptFlag(port, status);
-
-    //go through the list of the sensors to see which triggered the interrupt
-    int i;
-    for(i=0;i<NUM_COLS;i++){
-        if(sensors[i].port == port){ //only consider sensors belonging to this port
-            if(status & sensors[i].pin){ //check if that sensor's pin is the one that triggered
-                move_detected = sensors[i].column; //set the value of the move we detected
-                break;
-            }
-        }
-    }
+void Sensors_process_interrupt(HAL_Input_t input){
+    move_detected = (Move_t)(input - HAL_INPUT_SENSOR1); //set the value of the move we detected
 
     //block other sensors from triggering interrupts before returning
     disable_interrupts();
+    move_ready = true;
 }
@@ -0,0 +1,87 @@
+/*
+ * stateprofile.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/stateprofile.h"
+#include "include/timer.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "stdio.h"
+#include "string.h"
+
+static const char *const STATE_NAMES[NUM_STATES] = {
+    "INIT", "WAITING_FOR_MOVE", "CALCULATING_MOVE", "MAKING_MOVE", "PLAYER_VICTORY", "COMPUTER_VICTORY", "DRAW"
+};
+
+static const char *const LEVEL_NAMES[PROFILE_NUM_LEVELS] = {"easy", "medium", "hard"};
+
+static ProfileHistogram_t histograms[NUM_STATES][PROFILE_NUM_LEVELS];
+static ProfileLevel_t level;
+
+// time the running state function was called
+static Ticks_t entered;
+
+void Profile_clear(void){
+    memset(histograms, 0, sizeof(histograms));
+}
+
+void Profile_set_level(ProfileLevel_t new_level){
+    if (new_level < PROFILE_NUM_LEVELS) level = new_level;
+}
+
+void Profile_enter(State_t state){
+    (void)state;
+    entered = Timer_now();
+}
+
+void Profile_exit(State_t state){
+    uint32_t us = Timer_ticks_to_us(Timer_now() - entered);
+    ProfileHistogram_t *h = &histograms[state][level];
+
+    h->count++;
+    h->total_us += us;
+    if (us > h->max_us) h->max_us = us;
+    h->buckets[Profile_bucket(us)]++;
+}
+
+uint8_t Profile_bucket(uint32_t us){
+    // index of the highest bit set, 0 and 1 both go to bucket 0
+    uint8_t k = 0;
+    while (us > 1 && k < PROFILE_NUM_BUCKETS - 1) {
+        us >>= 1;
+        k++;
+    }
+    return k;
+}
+
+const ProfileHistogram_t *Profile_get(State_t state, ProfileLevel_t report_level){
+    return &histograms[state][report_level];
+}
+
+void Profile_report(ProfileWriter_t write){
+    // the longest line is a state name, a level name and three 10-digit numbers
+    char line[96];
+    int s, l, k;
+
+    write("state profile\n");
+    for (s = 0; s < NUM_STATES; s++) {
+        for (l = 0; l < PROFILE_NUM_LEVELS; l++) {
+            const ProfileHistogram_t *h = &histograms[s][l];
+            if (h->count == 0) continue;
+
+            snprintf(line, sizeof(line), "%s %s: %lu calls, mean %lu us, max %lu us\n", STATE_NAMES[s],
+                     LEVEL_NAMES[l], (unsigned long)h->count, (unsigned long)(h->total_us / h->count),
+                     (unsigned long)h->max_us);
+            write(line);
+            for (k = 0; k < PROFILE_NUM_BUCKETS; k++) {
+                if (h->buckets[k] == 0) continue;
+                snprintf(line, sizeof(line), "  %lu us: %lu\n", k ? 1ul << k : 0ul, (unsigned long)h->buckets[k]);
+                write(line);
+            }
+        }
+    }
+}
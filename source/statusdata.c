@@ -0,0 +1,196 @@
+/*
+ * statusdata.c
+ *
+ *  Generated by host/tools/gen_status.c, do not edit
+ */
+
+/* status line bitmaps: 7 messages and 7 digits, 584 bytes of flash
+ * see include/statusbitmaps.h for the format
+ */
+
+#include "include/statusbitmaps.h"
+#include "stdint.h"
+
+const char *const STATUS_TEXTS[NUM_STATUS_MESSAGES] = {
+    "Your move: Yellow",
+    "Calculating Move",
+    "Red moves to: ",
+    "You chose: ",
+    "You WON! :D",
+    "You Lost :(",
+    "Draw",
+};
+
+static const uint8_t status_your_move[104] = {
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x86, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x22, 0x00, 0x82, 0x00, 0x00,
+    0x89, 0xc8, 0xac, 0x03, 0x47, 0x22, 0x71, 0x80, 0x22, 0x70, 0x82, 0x1c, 0x88,
+    0x52, 0x28, 0xb2, 0x02, 0xa8, 0xa2, 0x88, 0x00, 0x14, 0x88, 0x82, 0x22, 0x88,
+    0x22, 0x28, 0xa0, 0x02, 0xa8, 0xa2, 0xf9, 0x80, 0x08, 0xf8, 0x82, 0x22, 0xa8,
+    0x22, 0x29, 0xa0, 0x02, 0x28, 0x94, 0x81, 0x80, 0x08, 0x80, 0x82, 0x22, 0xa8,
+    0x21, 0xc6, 0xa0, 0x02, 0x27, 0x08, 0x70, 0x00, 0x08, 0x71, 0xc7, 0x1c, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_calculating[96] = {
+    0x70, 0x06, 0x00, 0x01, 0x80, 0x10, 0x20, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x88, 0x02, 0x00, 0x00, 0x80, 0x10, 0x00, 0x07, 0x80, 0xd8, 0x00, 0x00,
+    0x81, 0xc2, 0x1c, 0x88, 0x87, 0x38, 0x62, 0xc8, 0x80, 0xa9, 0xc8, 0x9c,
+    0x80, 0x22, 0x20, 0x88, 0x80, 0x90, 0x23, 0x28, 0x80, 0xaa, 0x28, 0xa2,
+    0x81, 0xe2, 0x20, 0x88, 0x87, 0x90, 0x22, 0x27, 0x80, 0x8a, 0x28, 0xbe,
+    0x8a, 0x22, 0x22, 0x98, 0x88, 0x92, 0x22, 0x20, 0x80, 0x8a, 0x25, 0x20,
+    0x71, 0xe7, 0x1c, 0x69, 0xc7, 0x8c, 0x72, 0x27, 0x00, 0x89, 0xc2, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_red_moves_to[88] = {
+    0xf0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0x00,
+    0x89, 0xc6, 0x80, 0xd1, 0xc8, 0x9c, 0x70, 0x0e, 0x1c, 0x60, 0x00,
+    0xf2, 0x29, 0x80, 0xaa, 0x28, 0xa2, 0x80, 0x04, 0x22, 0x00, 0x00,
+    0xa3, 0xe8, 0x80, 0xaa, 0x28, 0xbe, 0x70, 0x04, 0x22, 0x60, 0x00,
+    0x92, 0x08, 0x80, 0x8a, 0x25, 0x20, 0x08, 0x04, 0xa2, 0x60, 0x00,
+    0x89, 0xc7, 0x80, 0x89, 0xc2, 0x1c, 0xf0, 0x03, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_you_chose[72] = {
+    0x88, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x89, 0xc8, 0x80, 0x72, 0xc7, 0x1c, 0x71, 0x80, 0x00,
+    0x52, 0x28, 0x80, 0x83, 0x28, 0xa0, 0x88, 0x00, 0x00,
+    0x22, 0x28, 0x80, 0x82, 0x28, 0x9c, 0xf9, 0x80, 0x00,
+    0x22, 0x29, 0x80, 0x8a, 0x28, 0x82, 0x81, 0x80, 0x00,
+    0x21, 0xc6, 0x80, 0x72, 0x27, 0x3c, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_you_won[72] = {
+    0x88, 0x00, 0x00, 0x89, 0xc8, 0x88, 0x00, 0x0e, 0x00,
+    0x88, 0x00, 0x00, 0x8a, 0x28, 0x88, 0x01, 0x89, 0x00,
+    0x89, 0xc8, 0x80, 0x8a, 0x2c, 0x88, 0x01, 0x88, 0x80,
+    0x52, 0x28, 0x80, 0xaa, 0x2a, 0x88, 0x00, 0x08, 0x80,
+    0x22, 0x28, 0x80, 0xaa, 0x29, 0x88, 0x01, 0x88, 0x80,
+    0x22, 0x29, 0x80, 0xaa, 0x28, 0x80, 0x01, 0x89, 0x00,
+    0x21, 0xc6, 0x80, 0x51, 0xc8, 0x88, 0x00, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_you_lost[72] = {
+    0x88, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x01, 0x00,
+    0x88, 0x00, 0x00, 0x80, 0x00, 0x10, 0x01, 0x82, 0x00,
+    0x89, 0xc8, 0x80, 0x81, 0xc7, 0x38, 0x01, 0x84, 0x00,
+    0x52, 0x28, 0x80, 0x82, 0x28, 0x10, 0x00, 0x04, 0x00,
+    0x22, 0x28, 0x80, 0x82, 0x27, 0x10, 0x01, 0x84, 0x00,
+    0x22, 0x29, 0x80, 0x82, 0x20, 0x92, 0x01, 0x82, 0x00,
+    0x21, 0xc6, 0x80, 0xf9, 0xcf, 0x0c, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_draw[24] = {
+    0xe0, 0x00, 0x00,
+    0x90, 0x00, 0x00,
+    0x8a, 0xc7, 0x22,
+    0x8b, 0x20, 0xa2,
+    0x8a, 0x07, 0xaa,
+    0x92, 0x08, 0xaa,
+    0xe2, 0x07, 0x94,
+    0x00, 0x00, 0x00,
+};
+
+static const uint8_t status_digit_1[8] = {
+    0x20,
+    0x60,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x70,
+    0x00,
+};
+
+static const uint8_t status_digit_2[8] = {
+    0x70,
+    0x88,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0xf8,
+    0x00,
+};
+
+static const uint8_t status_digit_3[8] = {
+    0xf8,
+    0x10,
+    0x20,
+    0x10,
+    0x08,
+    0x88,
+    0x70,
+    0x00,
+};
+
+static const uint8_t status_digit_4[8] = {
+    0x10,
+    0x30,
+    0x50,
+    0x90,
+    0xf8,
+    0x10,
+    0x10,
+    0x00,
+};
+
+static const uint8_t status_digit_5[8] = {
+    0xf8,
+    0x80,
+    0xf0,
+    0x08,
+    0x08,
+    0x88,
+    0x70,
+    0x00,
+};
+
+static const uint8_t status_digit_6[8] = {
+    0x30,
+    0x40,
+    0x80,
+    0xf0,
+    0x88,
+    0x88,
+    0x70,
+    0x00,
+};
+
+static const uint8_t status_digit_7[8] = {
+    0xf8,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0x40,
+    0x40,
+    0x00,
+};
+
+const StatusBitmap_t STATUS_MESSAGES[NUM_STATUS_MESSAGES] = {
+    {102, status_your_move},
+    {96, status_calculating},
+    {84, status_red_moves_to},
+    {66, status_you_chose},
+    {66, status_you_won},
+    {66, status_you_lost},
+    {24, status_draw},
+};
+
+const StatusBitmap_t STATUS_DIGITS[NUM_COLS] = {
+    {6, status_digit_1},
+    {6, status_digit_2},
+    {6, status_digit_3},
+    {6, status_digit_4},
+    {6, status_digit_5},
+    {6, status_digit_6},
+    {6, status_digit_7},
+};
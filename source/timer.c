@@ -0,0 +1,28 @@
+/*
+ * timer.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/timer.h"
+#include "include/hal.h"
+#include "stdint.h"
+
+// the counter is provided by the HAL: Timer32 on the MSP432, the monotonic clock on the host
+
+void Timer_init(void){
+    HAL_timer_init();
+}
+
+Ticks_t Timer_now(void){
+    return HAL_timer_now();
+}
+
+uint32_t Timer_ms_since(Ticks_t start){
+    return (Ticks_t)(Timer_now() - start) / HAL_timer_ticks_per_ms();
+}
+
+uint32_t Timer_ticks_to_us(Ticks_t ticks){
+    return (uint32_t)((uint64_t)ticks * 1000 / HAL_timer_ticks_per_ms());
+}
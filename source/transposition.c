@@ -0,0 +1,143 @@
+/*
+ * transposition.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+
+#include "include/transposition.h"
+#include "include/types.h"
+#include "stdint.h"
+#include "stdbool.h"
+#include "string.h"
+#ifdef HOST_BUILD
+#include "stdlib.h"
+#endif
+
+/* an entry is read and written as a single 64-bit word. on host builds the word is accessed atomically, so the threads
+ * of a parallel search (host/source/lazysmp.c) can share a table without locks: a racing reader gets either the old or
+ * the new entry, never half of each, and since the lock is part of the word it can not pair an entry with the wrong
+ * position. a store that races with another one on the same bucket may be lost, which only costs a re-search
+ */
+typedef union {
+    TTEntry_t entry;
+    uint64_t word;
+} TTSlot_t;
+
+typedef struct {
+    TTSlot_t slots[TT_BUCKET_SIZE];
+} TTBucket_t;
+
+// buckets of the table and generation of the current search, only the low 3 bits are stored in the entries
+struct TTTable {
+    TTBucket_t buckets[TT_NUM_BUCKETS];
+    uint8_t generation;
+};
+
+// the table itself, its size is fixed at compile time by TT_BUCKETS_LOG2
+static TTTable_t tt_default;
+
+#ifdef HOST_BUILD
+// table used by the calling thread, see TT_select()
+static THREAD_LOCAL TTTable_t *tt = &tt_default;
+#else
+static TTTable_t *const tt = &tt_default;
+#endif
+
+static inline TTEntry_t load_slot(const TTSlot_t *slot){
+    TTSlot_t s;
+#ifdef HOST_BUILD
+    s.word = __atomic_load_n(&slot->word, __ATOMIC_RELAXED);
+#else
+    s.word = slot->word;
+#endif
+    return s.entry;
+}
+
+static inline void store_slot(TTSlot_t *slot, TTEntry_t entry){
+    TTSlot_t s;
+    s.entry = entry;
+#ifdef HOST_BUILD
+    __atomic_store_n(&slot->word, s.word, __ATOMIC_RELAXED);
+#else
+    slot->word = s.word;
+#endif
+}
+
+void TT_clear(void){
+    memset(tt->buckets, 0, sizeof(tt->buckets));
+    tt->generation = 0;
+}
+
+void TT_new_search(void){
+    tt->generation = (tt->generation + 1) & 0x07;
+}
+
+bool TT_probe(Hash_t hash, TTEntry_t *entry){
+    TTBucket_t *bucket = &tt->buckets[hash & (TT_NUM_BUCKETS - 1)];
+    uint32_t lock = (uint32_t)(hash >> 32);
+    uint8_t i;
+
+    for (i = 0; i < TT_BUCKET_SIZE; i++) {
+        TTEntry_t e = load_slot(&bucket->slots[i]);
+        if (e.lock == lock && TT_ENTRY_BOUND(e) != BOUND_NONE) {
+            *entry = e;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TT_store(Hash_t hash, uint8_t depth, Score_t score, Bound_t bound, Move_t move){
+    TTBucket_t *bucket = &tt->buckets[hash & (TT_NUM_BUCKETS - 1)];
+    uint32_t lock = (uint32_t)(hash >> 32);
+    TTSlot_t *victim = &bucket->slots[0];
+    int16_t victim_worth = INT16_MAX;
+    uint8_t generation = tt->generation;
+    uint8_t i;
+
+    for (i = 0; i < TT_BUCKET_SIZE; i++) {
+        TTEntry_t e = load_slot(&bucket->slots[i]);
+        if (e.lock == lock || TT_ENTRY_BOUND(e) == BOUND_NONE) {
+            // same position (or free slot): keep the best move of a shallower search if this one has none
+            if (move == TT_NO_MOVE && e.lock == lock) move = TT_ENTRY_MOVE(e);
+            victim = &bucket->slots[i];
+            break;
+        }
+
+        // every search of age counts as much as 8 plies of depth
+        uint8_t age = (generation - TT_ENTRY_GENERATION(e)) & 0x07;
+        int16_t worth = (int16_t)e.depth - 8 * age;
+        if (worth < victim_worth) {
+            victim_worth = worth;
+            victim = &bucket->slots[i];
+        }
+    }
+
+    TTEntry_t entry;
+    entry.lock = lock;
+    entry.score = score;
+    entry.depth = depth;
+    entry.info = (uint8_t)((move & 0x07) | ((bound & 0x03) << 3) | (generation << 5));
+    store_slot(victim, entry);
+}
+
+#ifdef HOST_BUILD
+TTTable_t *TT_create(void){
+    // calloc() gives an empty table: every entry has BOUND_NONE
+    return calloc(1, sizeof(TTTable_t));
+}
+
+void TT_destroy(TTTable_t *table){
+    if (tt == table) tt = &tt_default;
+    free(table);
+}
+
+void TT_select(TTTable_t *table){
+    tt = table ? table : &tt_default;
+}
+
+TTTable_t *TT_selected(void){
+    return tt;
+}
+#endif